@@ -24,5 +24,14 @@ int main() {
         dbg::println("  Path {}: S(T) = {:.2f}", i + 1, ST);
     }
 
+    // Antithetic pairs: S(T) for Z and for its mirror -Z
+    method::MonteCarloPricer<double> antithetic_mc({ .num_simulations = 10, .seed = 42, .antithetic = true });
+
+    dbg::println("Simulating 5 antithetic pairs:");
+    for (int i = 0; i < 5; ++i) {
+        const auto [up, down] = antithetic_mc.simulate_gbm_terminal_pair(S0, r, sigma, T);
+        dbg::println("  Pair {}: S(T) = {:.2f} / {:.2f}, sample = {:.2f}", i + 1, up, down, (up + down) / 2.0);
+    }
+
     return 0;
 }
\ No newline at end of file
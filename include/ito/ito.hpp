@@ -2,7 +2,30 @@
 
 #include "core/option_pricer.hpp"
 #include "method/monte_carlo.hpp"
+#include "method/path_engine.hpp"
+#include "method/longstaff_schwartz.hpp"
+#include "method/multi_asset.hpp"
+#include "method/heston_engine.hpp"
+#include "method/jump_diffusion_engine.hpp"
+#include "method/local_vol_engine.hpp"
+#include "method/multilevel.hpp"
+#include "method/ito_process.hpp"
+#include "method/terminal_payoff.hpp"
+#include "method/risk_runner.hpp"
+#include "method/statistics.hpp"
 #include "model/black_scholes_model.hpp"
+#include "model/barrier_model.hpp"
+#include "model/heston_model.hpp"
+#include "model/jump_diffusion_model.hpp"
+#include "model/local_volatility.hpp"
+#include "model/fourier_pricing.hpp"
+#include "model/geometric_asian_model.hpp"
 #include "option/european_option.hpp"
 #include "utils/utils.hpp"
-#include "utils/math.hpp"
\ No newline at end of file
+#include "utils/math.hpp"
+#include "utils/dual.hpp"
+#include "utils/aad.hpp"
+#include "utils/random.hpp"
+#include "utils/sobol.hpp"
+#include "utils/linalg.hpp"
+#include "utils/vmath.hpp"
\ No newline at end of file
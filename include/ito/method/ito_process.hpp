@@ -0,0 +1,255 @@
+#pragma once
+#include <ito/utils/math.hpp>
+#include <ito/utils/random.hpp>
+#include <ito/method/path_engine.hpp>
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace ito::method {
+
+    enum class ItoScheme {
+        EulerMaruyama,  // X' = X + a Δ + b ΔW                       (strong order 1/2)
+        Milstein        // ... + 1/2 b ∂b/∂x (ΔW² - Δ)               (strong order 1)
+    };
+
+    /**
+     * Scalar Itô diffusion dX = a(t, X) dt + b(t, X) dW
+     * drift and diffusion are any callables T(T t, T x); Milstein also needs
+     * ∂b/∂x as a third one. They are held by value and called straight from
+     * the path loop of ItoPathEngine, so lambdas inline into it and the loop
+     * over paths compiles like a hand-written kernel (no virtual calls, no
+     * std::function).
+     *
+     *     ItoProcess vasicek(
+     *         [=](double, double r) { return kappa * (theta - r); },
+     *         [=](double, double) { return sigma; },
+     *         [](double, double) { return 0.0; });
+     */
+    template<typename Drift, typename Diffusion, typename DiffusionDerivative = std::nullptr_t>
+    class ItoProcess {
+    public:
+        static constexpr bool has_diffusion_derivative = !std::is_same_v<DiffusionDerivative, std::nullptr_t>;
+
+        constexpr ItoProcess(Drift drift, Diffusion diffusion, DiffusionDerivative diffusion_derivative = {})
+            : drift_(std::move(drift))
+            , diffusion_(std::move(diffusion))
+            , diffusion_derivative_(std::move(diffusion_derivative))
+        {
+        }
+
+        template<math::Arithmetic T>
+        constexpr T drift(T t, T x) const { return drift_(t, x); }
+
+        template<math::Arithmetic T>
+        constexpr T diffusion(T t, T x) const { return diffusion_(t, x); }
+
+        template<math::Arithmetic T>
+            requires has_diffusion_derivative
+        constexpr T diffusion_derivative(T t, T x) const { return diffusion_derivative_(t, x); }
+
+    private:
+        [[no_unique_address]] Drift drift_;
+        [[no_unique_address]] Diffusion diffusion_;
+        [[no_unique_address]] DiffusionDerivative diffusion_derivative_;
+    };
+
+    template<typename Drift, typename Diffusion>
+    ItoProcess(Drift, Diffusion) -> ItoProcess<Drift, Diffusion>;
+
+    template<typename Drift, typename Diffusion, typename DiffusionDerivative>
+    ItoProcess(Drift, Diffusion, DiffusionDerivative) -> ItoProcess<Drift, Diffusion, DiffusionDerivative>;
+
+    // Anything with drift(t, x) and diffusion(t, x) in T
+    template<typename Process, typename T>
+    concept ItoDiffusion = math::Arithmetic<T> && requires(const Process& process, T t, T x) {
+        { process.drift(t, x) } -> std::convertible_to<T>;
+        { process.diffusion(t, x) } -> std::convertible_to<T>;
+    };
+
+    template<math::Arithmetic T = double>
+    struct ItoPathCreateInfo {
+        T initial_value;                // X0 - state at t = 0
+        std::vector<T> times;           // observation times t_1 < ... < t_n (years)
+        T max_step = static_cast<T>(1) / static_cast<T>(100);  // largest time step (years)
+
+        void validate() const {
+            if (times.empty())
+                throw std::invalid_argument("Time grid needs at least one observation time");
+            for (size_t s{}; s < times.size(); ++s) {
+                if (!(times[s] > (s == 0 ? T{} : times[s - 1])))
+                    throw std::invalid_argument("Observation times must be positive and strictly increasing");
+            }
+            if (!(max_step > 0))
+                throw std::invalid_argument("Time step must be positive");
+        }
+    };
+
+    /**
+     * Path generator for an ItoProcess, Euler-Maruyama or Milstein
+     * The scheme is a template parameter, so the step loop carries no
+     * run-time switch. Each observation interval is cut into equal steps of
+     * at most max_step; step e draws its normal at counter (index p,
+     * dimension e), so paths do not depend on tiling or threading.
+     *
+     * Output is the state X itself (no exponential) in the PathView layout
+     * of GbmPathEngine; terminal() skips the path storage entirely.
+     */
+    template<math::Arithmetic T, typename Process, ItoScheme Scheme = ItoScheme::EulerMaruyama>
+        requires ItoDiffusion<Process, T> && (Scheme != ItoScheme::Milstein || Process::has_diffusion_derivative)
+    class ItoPathEngine {
+    public:
+        static constexpr size_t default_tile_size = 256;
+
+        ItoPathEngine(const Process& process, const ItoPathCreateInfo<T>& info, unsigned seed)
+            : process_(process)
+            , x0_(info.initial_value)
+            , times_(info.times)
+            , stream_(seed)
+        {
+            info.validate();
+
+            // Equal steps per observation interval
+            for (size_t s{}; s < times_.size(); ++s) {
+                const T t0 = s == 0 ? T{} : times_[s - 1];
+                const T interval = times_[s] - t0;
+                // (the tolerance keeps T / (T / n) from rounding up to n + 1 steps)
+                const size_t substeps = std::max<size_t>(1, static_cast<size_t>(std::ceil(interval / info.max_step - static_cast<T>(1e-9))));
+                const T dt = interval / static_cast<T>(substeps);
+                for (size_t e{}; e < substeps; ++e) {
+                    start_.push_back(t0 + static_cast<T>(e) * dt);
+                    dt_.push_back(dt);
+                    sqrt_dt_.push_back(std::sqrt(dt));
+                }
+                step_end_.push_back(dt_.size());
+            }
+        }
+
+        size_t num_steps() const noexcept { return times_.size(); }
+        size_t num_euler_steps() const noexcept { return dt_.size(); }
+        std::span<const T> times() const noexcept { return times_; }
+        T initial_value() const noexcept { return x0_; }
+        const Process& process() const noexcept { return process_; }
+
+        // Steps [first, last) of observation interval s
+        size_t first_euler_step(size_t s) const noexcept { return s == 0 ? 0 : step_end_[s - 1]; }
+        size_t last_euler_step(size_t s) const noexcept { return step_end_[s]; }
+
+        /**
+         * One step e for a block of states X given normals Z
+         * Exposed so pricers can drive it with their own (e.g. Sobol) normals.
+         */
+        void advance(size_t e, std::span<T> X, std::span<const T> Z) const noexcept {
+            const T t = start_[e];
+            const T dt = dt_[e];
+            const T sqrt_dt = sqrt_dt_[e];
+            for (size_t k{}; k < X.size(); ++k) {
+                const T x = X[k];
+                const T b = process_.diffusion(t, x);
+                const T dW = sqrt_dt * Z[k];
+                T next = x + process_.drift(t, x) * dt + b * dW;
+                if constexpr (Scheme == ItoScheme::Milstein) {
+                    next += static_cast<T>(0.5) * b * process_.diffusion_derivative(t, x) * (dW * dW - dt);
+                }
+                X[k] = next;
+            }
+        }
+
+        // X(t_n) of paths [first, first + count); mirror = true drives -Z
+        void terminal(std::span<T> out, size_t first, size_t count, bool mirror = false) const {
+            if (out.size() < count)
+                throw std::invalid_argument("Terminal buffer is smaller than count");
+
+            std::array<T, block_size> Z;
+            for (size_t b{}; b < count; b += block_size) {
+                const size_t n = std::min(block_size, count - b);
+                const std::span<T> X = out.subspan(b, n);
+                std::fill(X.begin(), X.end(), x0_);
+                for (size_t e{}; e < num_euler_steps(); ++e) {
+                    draw(std::span<T>(Z.data(), n), first + b, e, mirror);
+                    advance(e, X, std::span<const T>(Z.data(), n));
+                }
+            }
+        }
+
+        /**
+         * Paths [first, first + count) into `out` (time-major, count x num_steps)
+         * mirror = true drives the same paths with -Z (antithetic partners).
+         */
+        void generate(std::span<T> out, size_t first, size_t count, bool mirror = false) const {
+            if (out.size() < count * num_steps())
+                throw std::invalid_argument("Path buffer is smaller than count x num_steps");
+
+            std::array<T, block_size> X;
+            std::array<T, block_size> Z;
+            for (size_t b{}; b < count; b += block_size) {
+                const size_t n = std::min(block_size, count - b);
+                std::fill_n(X.begin(), n, x0_);
+                for (size_t s{}; s < num_steps(); ++s) {
+                    for (size_t e = first_euler_step(s); e < last_euler_step(s); ++e) {
+                        draw(std::span<T>(Z.data(), n), first + b, e, mirror);
+                        advance(e, std::span<T>(X.data(), n), std::span<const T>(Z.data(), n));
+                    }
+                    std::copy_n(X.begin(), n, out.begin() + s * count + b);
+                }
+            }
+        }
+
+        // Materialize paths [first, first + count)
+        PathSet<T> simulate(size_t first, size_t count, bool mirror = false) const {
+            PathSet<T> paths{
+                .values = std::vector<T>(count * num_steps()),
+                .num_paths = count,
+                .num_steps = num_steps()
+            };
+            generate(paths.values, first, count, mirror);
+            return paths;
+        }
+
+        /**
+         * Block mode: call f(PathView tile, size_t first_path) for consecutive
+         * tiles of paths [first, first + count); one tile buffer is reused
+         */
+        template<typename Function>
+        void for_each_tile(size_t first, size_t count, Function&& f, size_t tile_size = default_tile_size) const {
+            if (tile_size == 0)
+                throw std::invalid_argument("Tile size must be positive");
+
+            std::vector<T> tile(std::min(tile_size, count) * num_steps());
+            for (size_t p{}; p < count; p += tile_size) {
+                const size_t n = std::min(tile_size, count - p);
+                generate(tile, first + p, n);
+                f(PathView<T>(std::span<const T>(tile.data(), n * num_steps()), n, num_steps()), first + p);
+            }
+        }
+
+    private:
+        // Paths whose state is carried across steps at once
+        static constexpr size_t block_size = 256;
+
+        void draw(std::span<T> Z, size_t first, size_t e, bool mirror) const noexcept {
+            stream_.fill_normal(Z, first, static_cast<std::uint32_t>(e));
+            if (mirror) {
+                for (T& z : Z) z = -z;
+            }
+        }
+
+        Process process_;
+        T x0_;
+        std::vector<T> times_;
+        std::vector<size_t> step_end_;  // one past the last step of each interval
+        std::vector<T> start_;          // start time of each step
+        std::vector<T> dt_;
+        std::vector<T> sqrt_dt_;
+        random::CounterRng<T> stream_;
+    };
+
+} // namespace ito::method
@@ -0,0 +1,198 @@
+#pragma once
+#include <ito/utils/math.hpp>
+#include <ito/utils/random.hpp>
+#include <ito/utils/vmath.hpp>
+#include <ito/method/path_engine.hpp>
+#include <ito/model/jump_diffusion_model.hpp>
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+namespace ito::method {
+
+    template<math::Arithmetic T = double, typename Jumps = model::MertonJumps<T>>
+    struct JumpDiffusionPathCreateInfo {
+        T spot_price;           // S0 - price at t = 0
+        T risk_free_rate;       // r - risk-free interest rate (annualized)
+        T volatility;           // σ (sigma) - diffusion volatility (annualized)
+        T jump_intensity;       // λ (lambda) - expected jumps per year
+        Jumps jumps;            // law of the log jump size Y
+        std::vector<T> times;   // observation times t_1 < ... < t_n (years)
+
+        void validate() const {
+            if (spot_price <= 0)
+                throw std::invalid_argument("Spot price must be positive");
+            if (volatility < 0)
+                throw std::invalid_argument("Volatility cannot be negative");
+            if (jump_intensity < 0)
+                throw std::invalid_argument("Jump intensity cannot be negative");
+            if (times.empty())
+                throw std::invalid_argument("Time grid needs at least one observation time");
+            for (size_t s{}; s < times.size(); ++s) {
+                if (!(times[s] > (s == 0 ? T{} : times[s - 1])))
+                    throw std::invalid_argument("Observation times must be positive and strictly increasing");
+            }
+            jumps.validate();
+        }
+    };
+
+    /**
+     * Jump-diffusion path generator with exact jump times
+     *     ln S(t_s) = ln S(t_s-1) + (r - λκ - σ²/2) Δ + σ √Δ Z_s + Σ Y_j over jumps in (t_s-1, t_s]
+     * Arrivals are simulated exactly (exponential inter-arrival times) and
+     * each jump is booked into the interval it falls in, so the grid only has
+     * to hold the observation dates - there is no discretization bias at any
+     * step size. The jump law is a policy (model::MertonJumps, model::KouJumps).
+     *
+     * Path p draws its diffusion normal of step s at counter (index p,
+     * dimension s) and jump j from the uniform pair (block p, dimension j):
+     * one uniform for the arrival, one for the size. Paths therefore do not
+     * depend on tiling or threading.
+     */
+    template<math::Arithmetic T = double, typename Jumps = model::MertonJumps<T>>
+    class JumpDiffusionPathEngine {
+    public:
+        static constexpr size_t default_tile_size = 256;
+
+        JumpDiffusionPathEngine(const JumpDiffusionPathCreateInfo<T, Jumps>& info, unsigned seed)
+            : S0_(info.spot_price)
+            , lambda_(info.jump_intensity)
+            , jumps_(info.jumps)
+            , times_(info.times)
+            , stream_(seed)
+        {
+            info.validate();
+
+            // Compensated drift: E[S(t)] = S0 e^(rt) with jumps included
+            const T kappa = lambda_ > 0 ? jumps_.compensator() : T{};
+            const T sigma = info.volatility;
+            drift_.reserve(times_.size());
+            vol_.reserve(times_.size());
+            for (size_t s{}; s < times_.size(); ++s) {
+                const T dt = times_[s] - (s == 0 ? T{} : times_[s - 1]);
+                drift_.push_back((info.risk_free_rate - lambda_ * kappa - sigma * sigma / static_cast<T>(2)) * dt);
+                vol_.push_back(sigma * std::sqrt(dt));
+            }
+        }
+
+        size_t num_steps() const noexcept { return times_.size(); }
+        std::span<const T> times() const noexcept { return times_; }
+        T spot_price() const noexcept { return S0_; }
+
+        /**
+         * Log jump totals of paths [first, first + count) per observation
+         * interval into J (time-major, count x num_steps)
+         */
+        void jump_sums(std::span<T> J, size_t first, size_t count) const {
+            std::fill_n(J.begin(), count * num_steps(), T{});
+            if (!(lambda_ > 0)) return;
+
+            const T horizon = times_.back();
+            for (size_t k{}; k < count; ++k) {
+                size_t s{};
+                T t{};
+                for (std::uint32_t j{};; ++j) {
+                    // Step 1 - Next arrival: exponential gap with mean 1/λ
+                    const auto [u_arrival, u_size] = stream_.uniform_pair(first + k, j);
+                    t -= std::log(u_arrival) / lambda_;
+                    if (t > horizon) break;
+
+                    // Step 2 - Book the jump into its observation interval
+                    while (times_[s] < t) ++s;
+                    J[s * count + k] += jumps_.sample(u_size);
+                }
+            }
+        }
+
+        // One step for a block: X += drift + σ √Δ Z + J (J may be empty)
+        void advance(size_t s, std::span<T> X, std::span<const T> Z, std::span<const T> J) const noexcept {
+            for (size_t k{}; k < X.size(); ++k) {
+                X[k] += drift_[s] + vol_[s] * Z[k];
+            }
+            for (size_t k{}; k < J.size(); ++k) {
+                X[k] += J[k];
+            }
+        }
+
+        /**
+         * Paths [first, first + count) into `out` (time-major, count x num_steps)
+         * mirror = true negates the diffusion normals and keeps the jumps.
+         */
+        void generate(std::span<T> out, size_t first, size_t count, bool mirror = false) const {
+            if (out.size() < count * num_steps())
+                throw std::invalid_argument("Path buffer is smaller than count x num_steps");
+
+            std::array<T, block_size> X;
+            std::vector<T> J(block_size * num_steps());
+
+            for (size_t b{}; b < count; b += block_size) {
+                const size_t n = std::min(block_size, count - b);
+                std::fill_n(X.begin(), n, T{});
+                jump_sums(J, first + b, n);
+
+                for (size_t s{}; s < num_steps(); ++s) {
+                    const std::span<T> row = out.subspan(s * count + b, n);
+
+                    // Step 1 - Diffusion normals straight into the output row
+                    stream_.fill_normal(row, first + b, static_cast<std::uint32_t>(s));
+                    if (mirror) {
+                        for (size_t k{}; k < n; ++k) row[k] = -row[k];
+                    }
+
+                    // Step 2 - Diffusion plus the step's jumps, then S = S0 * exp(X)
+                    advance(s, std::span<T>(X.data(), n), std::span<const T>(row), std::span<const T>(J.data() + s * n, n));
+                    math::vexp(std::span<const T>(X.data(), n), row);
+                    for (size_t k{}; k < n; ++k) {
+                        row[k] *= S0_;
+                    }
+                }
+            }
+        }
+
+        // Materialize paths [first, first + count)
+        PathSet<T> simulate(size_t first, size_t count, bool mirror = false) const {
+            PathSet<T> paths{
+                .values = std::vector<T>(count * num_steps()),
+                .num_paths = count,
+                .num_steps = num_steps()
+            };
+            generate(paths.values, first, count, mirror);
+            return paths;
+        }
+
+        /**
+         * Block mode: call f(PathView tile, size_t first_path) for consecutive
+         * tiles of paths [first, first + count); one tile buffer is reused
+         */
+        template<typename Function>
+        void for_each_tile(size_t first, size_t count, Function&& f, size_t tile_size = default_tile_size) const {
+            if (tile_size == 0)
+                throw std::invalid_argument("Tile size must be positive");
+
+            std::vector<T> tile(std::min(tile_size, count) * num_steps());
+            for (size_t p{}; p < count; p += tile_size) {
+                const size_t n = std::min(tile_size, count - p);
+                generate(tile, first + p, n);
+                f(PathView<T>(std::span<const T>(tile.data(), n * num_steps()), n, num_steps()), first + p);
+            }
+        }
+
+    private:
+        // Paths whose state is carried across steps at once
+        static constexpr size_t block_size = 256;
+
+        T S0_;
+        T lambda_;
+        Jumps jumps_;
+        std::vector<T> times_;
+        std::vector<T> drift_;
+        std::vector<T> vol_;
+        random::CounterRng<T> stream_;
+    };
+
+} // namespace ito::method
@@ -0,0 +1,199 @@
+#pragma once
+#include <ito/utils/math.hpp>
+#include <ito/utils/random.hpp>
+#include <ito/utils/vmath.hpp>
+#include <ito/method/path_engine.hpp>
+#include <ito/model/local_volatility.hpp>
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+namespace ito::method {
+
+    template<math::Arithmetic T = double>
+    struct LocalVolPathCreateInfo {
+        std::vector<T> times;           // observation times t_1 < ... < t_n (years)
+        T max_step = static_cast<T>(1) / static_cast<T>(100);  // largest Euler step (years)
+
+        void validate() const {
+            if (times.empty())
+                throw std::invalid_argument("Time grid needs at least one observation time");
+            for (size_t s{}; s < times.size(); ++s) {
+                if (!(times[s] > (s == 0 ? T{} : times[s - 1])))
+                    throw std::invalid_argument("Observation times must be positive and strictly increasing");
+            }
+            if (!(max_step > 0))
+                throw std::invalid_argument("Euler step must be positive");
+        }
+    };
+
+    /**
+     * Local-volatility path generator, log-Euler scheme
+     *     ln S' = ln S + (r - σ²/2) Δ + σ √Δ Z,  σ = σ_loc(t, ln S)
+     * Each observation interval is cut into equal Euler steps of at most
+     * max_step. σ is frozen over a step, so E[S'|S] = S e^(rΔ) exactly and
+     * S_T stays a valid control variate; the bias is in the law of the path.
+     *
+     * The surface's time interpolation is done once here: every Euler step
+     * keeps its own row of σ_loc (model::LocalVolSurface::slice), so the
+     * per-path cost is one clamped linear lookup into num_log_spots values.
+     *
+     * Euler step e draws its normal at counter (index p, dimension e), so
+     * paths do not depend on tiling or threading. Output uses the PathView
+     * layout of GbmPathEngine and feeds the same payoff kernels.
+     */
+    template<math::Arithmetic T = double>
+    class LocalVolPathEngine {
+    public:
+        static constexpr size_t default_tile_size = 256;
+
+        LocalVolPathEngine(const model::LocalVolSurface<T>& surface, const LocalVolPathCreateInfo<T>& info, unsigned seed)
+            : surface_(surface)
+            , times_(info.times)
+            , stream_(seed)
+        {
+            info.validate();
+
+            // Step 1 - Euler steps per observation interval
+            const T r = surface.risk_free_rate();
+            const size_t width = surface.num_log_spots();
+            step_end_.reserve(times_.size());
+            for (size_t s{}; s < times_.size(); ++s) {
+                const T t0 = s == 0 ? T{} : times_[s - 1];
+                const T interval = times_[s] - t0;
+                // (the tolerance keeps T / (T / n) from rounding up to n + 1 steps)
+                const size_t substeps = std::max<size_t>(1, static_cast<size_t>(std::ceil(interval / info.max_step - static_cast<T>(1e-9))));
+                const T dt = interval / static_cast<T>(substeps);
+
+                // Step 2 - Per Euler step: r Δ, √Δ and the σ_loc row at its start
+                for (size_t e{}; e < substeps; ++e) {
+                    r_dt_.push_back(r * dt);
+                    half_dt_.push_back(dt / static_cast<T>(2));
+                    sqrt_dt_.push_back(std::sqrt(dt));
+                    slices_.resize(slices_.size() + width);
+                    surface.slice(t0 + static_cast<T>(e) * dt, std::span<T>(slices_.end() - width, slices_.end()));
+                }
+                step_end_.push_back(r_dt_.size());
+            }
+        }
+
+        size_t num_steps() const noexcept { return times_.size(); }
+        size_t num_euler_steps() const noexcept { return r_dt_.size(); }
+        std::span<const T> times() const noexcept { return times_; }
+        T spot_price() const noexcept { return surface_.spot_price(); }
+        T risk_free_rate() const noexcept { return surface_.risk_free_rate(); }
+
+        // Euler steps [first, last) of observation interval s
+        size_t first_euler_step(size_t s) const noexcept { return s == 0 ? 0 : step_end_[s - 1]; }
+        size_t last_euler_step(size_t s) const noexcept { return step_end_[s]; }
+
+        /**
+         * One Euler step e for a block: X (log-return since t = 0) advances
+         * given normals Z; sigma is scratch of the same length.
+         * Exposed so pricers can drive it with their own (e.g. Sobol) normals.
+         */
+        void advance(size_t e, std::span<T> X, std::span<const T> Z, std::span<T> sigma) const noexcept {
+            const size_t width = surface_.num_log_spots();
+            const std::span<const T> slice(slices_.data() + e * width, width);
+            const T log_S0 = std::log(surface_.spot_price());
+
+            // Step 1 - σ_loc at the current log-spot
+            for (size_t k{}; k < X.size(); ++k) {
+                sigma[k] = X[k] + log_S0;
+            }
+            surface_.lookup(slice, sigma, sigma);
+
+            // Step 2 - Log-Euler increment
+            const T r_dt = r_dt_[e];
+            const T half_dt = half_dt_[e];
+            const T sqrt_dt = sqrt_dt_[e];
+            for (size_t k{}; k < X.size(); ++k) {
+                const T vol = sigma[k];
+                X[k] += r_dt - half_dt * vol * vol + vol * sqrt_dt * Z[k];
+            }
+        }
+
+        /**
+         * Paths [first, first + count) into `out` (time-major, count x num_steps)
+         * mirror = true drives the same paths with -Z (antithetic partners).
+         */
+        void generate(std::span<T> out, size_t first, size_t count, bool mirror = false) const {
+            if (out.size() < count * num_steps())
+                throw std::invalid_argument("Path buffer is smaller than count x num_steps");
+
+            std::array<T, block_size> X;
+            std::array<T, block_size> Z;
+            std::array<T, block_size> sigma;
+
+            for (size_t b{}; b < count; b += block_size) {
+                const size_t n = std::min(block_size, count - b);
+                std::fill_n(X.begin(), n, T{});
+
+                for (size_t s{}; s < num_steps(); ++s) {
+                    // Step 1 - Euler steps of the interval
+                    for (size_t e = first_euler_step(s); e < last_euler_step(s); ++e) {
+                        stream_.fill_normal(std::span<T>(Z.data(), n), first + b, static_cast<std::uint32_t>(e));
+                        if (mirror) {
+                            for (size_t k{}; k < n; ++k) Z[k] = -Z[k];
+                        }
+                        advance(e, std::span<T>(X.data(), n), std::span<const T>(Z.data(), n), std::span<T>(sigma.data(), n));
+                    }
+
+                    // Step 2 - S(t_s) = S0 * exp(X)
+                    const std::span<T> row = out.subspan(s * count + b, n);
+                    math::vexp(std::span<const T>(X.data(), n), row);
+                    for (size_t k{}; k < n; ++k) {
+                        row[k] *= spot_price();
+                    }
+                }
+            }
+        }
+
+        // Materialize paths [first, first + count)
+        PathSet<T> simulate(size_t first, size_t count, bool mirror = false) const {
+            PathSet<T> paths{
+                .values = std::vector<T>(count * num_steps()),
+                .num_paths = count,
+                .num_steps = num_steps()
+            };
+            generate(paths.values, first, count, mirror);
+            return paths;
+        }
+
+        /**
+         * Block mode: call f(PathView tile, size_t first_path) for consecutive
+         * tiles of paths [first, first + count); one tile buffer is reused
+         */
+        template<typename Function>
+        void for_each_tile(size_t first, size_t count, Function&& f, size_t tile_size = default_tile_size) const {
+            if (tile_size == 0)
+                throw std::invalid_argument("Tile size must be positive");
+
+            std::vector<T> tile(std::min(tile_size, count) * num_steps());
+            for (size_t p{}; p < count; p += tile_size) {
+                const size_t n = std::min(tile_size, count - p);
+                generate(tile, first + p, n);
+                f(PathView<T>(std::span<const T>(tile.data(), n * num_steps()), n, num_steps()), first + p);
+            }
+        }
+
+    private:
+        // Paths whose state is carried across steps at once
+        static constexpr size_t block_size = 256;
+
+        model::LocalVolSurface<T> surface_;
+        std::vector<T> times_;
+        std::vector<size_t> step_end_;  // one past the last Euler step of each interval
+        std::vector<T> r_dt_;
+        std::vector<T> half_dt_;
+        std::vector<T> sqrt_dt_;
+        std::vector<T> slices_;         // σ_loc rows, one per Euler step
+        random::CounterRng<T> stream_;
+    };
+
+} // namespace ito::method
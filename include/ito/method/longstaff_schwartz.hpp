@@ -0,0 +1,109 @@
+#pragma once
+#include <ito/utils/math.hpp>
+#include <ito/utils/vmath.hpp>
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+namespace ito::method {
+
+    enum class OptionType {
+        Call,
+        Put
+    };
+
+    template<math::Arithmetic T = double>
+    struct AmericanCreateInfo {
+        T spot_price;                   // S - current price of underlying
+        T strike_price;                 // K - strike/exercise price
+        T risk_free_rate;               // r - risk-free interest rate (annualized)
+        T volatility;                   // σ (sigma) - volatility (annualized)
+        std::vector<T> exercise_times;  // t_1 < ... < t_n (years); t_n is the maturity
+        OptionType type = OptionType::Put;
+
+        void validate() const {
+            if (spot_price <= 0)
+                throw std::invalid_argument("Spot price must be positive");
+            if (strike_price <= 0)
+                throw std::invalid_argument("Strike price must be positive");
+            if (volatility < 0)
+                throw std::invalid_argument("Volatility cannot be negative");
+            if (exercise_times.empty())
+                throw std::invalid_argument("American option needs at least one exercise time");
+            for (size_t i{}; i < exercise_times.size(); ++i) {
+                if (!(exercise_times[i] > (i == 0 ? T{} : exercise_times[i - 1])))
+                    throw std::invalid_argument("Exercise times must be positive and strictly increasing");
+            }
+        }
+    };
+
+    /**
+     * Regression basis for least-squares Monte Carlo
+     * evaluate(x, columns) writes the size() basis functions of every state in
+     * x column-major: function j of state i at columns[j * x.size() + i].
+     * States are moneyness S/K, so the same basis suits any strike.
+     */
+    template<typename Basis, typename T>
+    concept RegressionBasis = requires(const Basis& basis, std::span<const T> x, std::span<T> columns) {
+        { basis.size() } -> std::convertible_to<size_t>;
+        basis.evaluate(x, columns);
+    };
+
+    // Monomials 1, x, x², ..., x^degree
+    template<math::Arithmetic T = double>
+    struct PolynomialBasis {
+        size_t degree = 3;
+
+        size_t size() const noexcept { return degree + 1; }
+
+        void evaluate(std::span<const T> x, std::span<T> columns) const noexcept {
+            const size_t m = x.size();
+            std::fill_n(columns.begin(), m, static_cast<T>(1));
+            for (size_t j = 1; j <= degree; ++j) {
+                for (size_t i{}; i < m; ++i) {
+                    columns[j * m + i] = columns[(j - 1) * m + i] * x[i];
+                }
+            }
+        }
+    };
+
+    /**
+     * Constant plus weighted Laguerre polynomials e^(-x/2) L_j(x), j < degree
+     * (Longstaff & Schwartz, 2001), with the recurrence
+     *     L_0 = 1, L_1 = 1 - x, (j + 1) L_j+1 = (2j + 1 - x) L_j - j L_j-1
+     */
+    template<math::Arithmetic T = double>
+    struct LaguerreBasis {
+        size_t degree = 3;
+
+        size_t size() const noexcept { return degree + 1; }
+
+        void evaluate(std::span<const T> x, std::span<T> columns) const {
+            const size_t m = x.size();
+            std::fill_n(columns.begin(), m, static_cast<T>(1));
+            if (degree == 0) return;
+
+            // Step 1 - Weight e^(-x/2) = L_0 column, one SIMD exp pass
+            const std::span<T> weight = columns.subspan(m, m);
+            for (size_t i{}; i < m; ++i) {
+                weight[i] = -x[i] / static_cast<T>(2);
+            }
+            math::vexp(std::span<const T>(weight), weight);
+
+            // Step 2 - Weighted recurrence, column by column
+            for (size_t j = 2; j <= degree; ++j) {
+                const size_t n = j - 2;  // column j - 1 holds L_n, column j gets L_n+1
+                for (size_t i{}; i < m; ++i) {
+                    const T L_n = columns[(j - 1) * m + i];
+                    const T L_prev = n == 0 ? T{} : columns[(j - 2) * m + i];
+                    columns[j * m + i] = ((static_cast<T>(2 * n + 1) - x[i]) * L_n - static_cast<T>(n) * L_prev)
+                        / static_cast<T>(n + 1);
+                }
+            }
+        }
+    };
+
+} // namespace ito::method
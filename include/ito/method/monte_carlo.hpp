@@ -1,11 +1,36 @@
 ﻿#pragma once
 #include <ito/utils/math.hpp>
+#include <ito/utils/random.hpp>
+#include <ito/utils/sobol.hpp>
+#include <ito/utils/vmath.hpp>
+#include <ito/utils/linalg.hpp>
+#include <ito/utils/aad.hpp>
+#include <ito/method/statistics.hpp>
+#include <ito/method/path_engine.hpp>
+#include <ito/method/longstaff_schwartz.hpp>
+#include <ito/method/multi_asset.hpp>
+#include <ito/method/heston_engine.hpp>
+#include <ito/method/jump_diffusion_engine.hpp>
+#include <ito/method/local_vol_engine.hpp>
+#include <ito/method/multilevel.hpp>
+#include <ito/method/ito_process.hpp>
+#include <ito/method/terminal_payoff.hpp>
+#include <ito/model/geometric_asian_model.hpp>
+#include <ito/model/barrier_model.hpp>
+#include <ito/model/heston_model.hpp>
+#include <ito/model/jump_diffusion_model.hpp>
+#include <ito/model/local_volatility.hpp>
+#include <array>
+#include <chrono>
 #include <random>
+#include <span>
+#include <stdexcept>
+#include <utility>
 #include <vector>
 #include <cmath>
-#include <numeric>
 #include <algorithm>
 #include <execution>
+#include <numbers>
 
 namespace ito::method {
 
@@ -21,6 +46,45 @@ namespace ito::method {
         };
 
         ExecutionPolicy policy = ExecutionPolicy::Auto;
+
+        // Antithetic variates: every draw Z is paired with -Z and the pair
+        // average is one sample, so num_simulations paths give N/2 samples
+        bool antithetic = false;
+
+        // Control variate: regress payoffs on S(T), whose expectation S0*e^(rT)
+        // is known exactly under GBM; beta is estimated from the same paths
+        bool control_variate = false;
+
+        enum class Sampling {
+            PseudoRandom,  // Philox / mt19937 normals (default)
+            Sobol          // Digitally shifted Sobol points through the inverse normal CDF
+        };
+
+        Sampling sampling = Sampling::PseudoRandom;
+
+        // Sobol only: independent digital shifts of the point set. Paths are
+        // split evenly between them (a power of two per shift is best) and the
+        // standard error is taken across the per-shift estimates.
+        size_t num_randomizations = 16;
+
+        // Adaptive stopping: when a target error or a time budget is set, paths
+        // are simulated in batches of batch_size and the run stops as soon as
+        // any criterion is met. max_paths caps the run (0 = num_simulations);
+        // on its own it caps a fixed run at min(num_simulations, max_paths).
+        // The cap is rounded down to whole samples (antithetic pairs, one
+        // point per Sobol shift), so num_paths never exceeds it - unless it
+        // is below a single sample, which is always simulated.
+        T target_standard_error = static_cast<T>(0);   // 0 = off; applies to call and put
+        std::chrono::duration<double> max_wall_time{}; // 0 = off
+        size_t max_paths = 0;
+        size_t batch_size = 65'536;
+    };
+
+    // Why a Monte Carlo run ended
+    enum class StopReason {
+        PathBudget,   // all requested paths simulated (always the case for fixed runs)
+        TargetError,  // standard error reached target_standard_error
+        WallTime      // max_wall_time elapsed
     };
 
     template<math::Arithmetic T = double>
@@ -33,21 +97,35 @@ namespace ito::method {
         }
     };
 
+    /**
+     * T may also be a number type such as math::Dual<double, N> for the
+     * European call/put and grid engines: inputs seeded with Dual::variable
+     * come back with their pathwise sensitivities in .grad of each price.
+     * (The standard error's tangents are those of the error itself.)
+     */
     template<math::Arithmetic T = double>
     class MonteCarloPricer {
         //private:
     public:
         MonteCarloCreateInfo<T> config_;
         mutable std::mt19937 rng_;
-        mutable std::normal_distribution<T> normal_;
+        mutable std::normal_distribution<math::scalar_t<T>> normal_;
+        random::CounterRng<math::scalar_t<T>> stream_;   // counter-based normals, indexed by sample
+        random::SobolSequence sobol_;    // dimension m: normal of the step to maturity m
 
         // GBM simulation - PRIVATE helper
+        // (antithetic mode: one sample is the average of S(T) over Z and -Z)
         T simulate_gbm_terminal(
             T S0,
             T r,
             T sigma,
             T time
         ) const {
+            if (config_.antithetic) {
+                const auto [up, down] = simulate_gbm_terminal_pair(S0, r, sigma, time);
+                return (up + down) / static_cast<T>(2);
+            }
+
             // Step 1 - Generate random Z ~ N(0,1)
             T Z = normal_(rng_);
 
@@ -61,33 +139,52 @@ namespace ito::method {
             return S0 * std::exp(drift + diffusion);
         }
 
-        // Statistics computation - PRIVATE helper
-        MonteCarloResult<T> compute_statistics(
-            const std::vector<T>& payoffs,
-            T discount_factor
+        // Antithetic GBM simulation: S(T) for one draw Z and for its mirror -Z,
+        // so the pair never outlives the call - PRIVATE helper
+        std::pair<T, T> simulate_gbm_terminal_pair(
+            T S0,
+            T r,
+            T sigma,
+            T time
         ) const {
-            const size_t N = payoffs.size();
-            // Step 1 - Compute mean of payoffs
-            T sum = std::accumulate(payoffs.begin(), payoffs.end(), T{});
-            T mean = sum / N;
+            const T Z = normal_(rng_);
+            const T drift = (r - (sigma * sigma) / static_cast<T>(2)) * time;
+            const T diffusion = sigma * std::sqrt(time) * Z;
+            return { S0 * std::exp(drift + diffusion), S0 * std::exp(drift - diffusion) };
+        }
 
-            // Step 2 - Compute variance
-            // variance = (1/(N-1)) * Σ(payoff - mean)²
-            T variance = static_cast<T>(0);
-            for (const auto& payoff : payoffs) {
-                T diff = payoff - mean;
-                variance += diff * diff;
-            }
-            variance /= N - 1;
+        // Statistics computation - PRIVATE helper
+        static MonteCarloResult<T> compute_statistics(
+            const RunningStatistics<T>& payoffs,
+            T discount_factor
+        ) {
+            // Mean and standard error are accumulated in a single pass;
+            // only the discounting is left to do here
+            return {
+                .price = discount_factor * payoffs.mean(),
+                .standard_error = discount_factor * payoffs.standard_error()
+            };
+        }
 
-            // Step 3 - Compute standard error
-            // std_error = sqrt(variance / N)
-            T std_error = std::sqrt(variance / N);
+        static MonteCarloResult<T> compute_statistics(
+            const BatchStatistics<T>& payoffs,
+            T discount_factor
+        ) {
+            return {
+                .price = discount_factor * payoffs.mean(),
+                .standard_error = discount_factor * payoffs.standard_error()
+            };
+        }
 
-            // Return discounted results
+        static MonteCarloResult<T> compute_statistics(
+            const ControlVariateStatistics<T, 1>& payoffs,
+            T expected_control,
+            T discount_factor
+        ) {
+            // Variance-reduced mean and residual standard error
             return {
-                .price = discount_factor * mean,
-                .standard_error = discount_factor * std_error
+                .price = discount_factor * payoffs.mean({ expected_control }),
+                .standard_error = discount_factor * payoffs.standard_error()
             };
         }
 
@@ -96,123 +193,2424 @@ namespace ito::method {
             : config_(config)
             , rng_(config.seed)
             , normal_(0.0, 1.0)
+            , stream_(config.seed)
+            , sobol_(random::SobolSequence::max_dimensions)
         {
         }
 
         struct CallPutResult {
             MonteCarloResult<T> call;
             MonteCarloResult<T> put;
+            size_t num_paths = 0;  // paths actually simulated
+            StopReason stop_reason = StopReason::PathBudget;
+
+            T max_standard_error() const noexcept {
+                return std::max(call.standard_error, put.standard_error);
+            }
+        };
+
+        // Calls and puts of a strike x maturity grid, stored maturity-major
+        struct GridResult {
+            std::vector<MonteCarloResult<T>> calls;
+            std::vector<MonteCarloResult<T>> puts;
+            size_t num_strikes = 0;
+            size_t num_paths = 0;  // paths actually simulated
+            StopReason stop_reason = StopReason::PathBudget;
+
+            const MonteCarloResult<T>& call(size_t maturity, size_t strike) const {
+                return calls[maturity * num_strikes + strike];
+            }
+
+            const MonteCarloResult<T>& put(size_t maturity, size_t strike) const {
+                return puts[maturity * num_strikes + strike];
+            }
+
+            T max_standard_error() const noexcept {
+                T worst{};
+                for (size_t c{}; c < calls.size(); ++c) {
+                    worst = std::max({ worst, calls[c].standard_error, puts[c].standard_error });
+                }
+                return worst;
+            }
+        };
+
+        // Price and first-order Greeks of one option, each with its standard error
+        struct Greeks {
+            MonteCarloResult<T> price;
+            MonteCarloResult<T> delta;  // ∂V/∂S0
+            MonteCarloResult<T> vega;   // ∂V/∂σ
+            MonteCarloResult<T> rho;    // ∂V/∂r
+        };
+
+        struct GreeksResult {
+            Greeks call;
+            Greeks put;
+            size_t num_paths = 0;  // paths actually simulated
+            StopReason stop_reason = StopReason::PathBudget;
+
+            // Adaptive runs target the price error
+            T max_standard_error() const noexcept {
+                return std::max(call.price.standard_error, put.price.standard_error);
+            }
+        };
+
+        // Price, delta and gamma of one position
+        struct TerminalGreeks {
+            MonteCarloResult<T> price;
+            MonteCarloResult<T> delta;  // ∂V/∂S0
+            MonteCarloResult<T> gamma;  // ∂²V/∂S0²
+        };
+
+        // Per-position and whole-book estimates from one simulation
+        struct BookGreeksResult {
+            std::vector<TerminalGreeks> positions;
+            TerminalGreeks total;
+            size_t num_paths = 0;  // paths actually simulated
+            StopReason stop_reason = StopReason::PathBudget;
+
+            // Adaptive runs target the error of the book's value
+            T max_standard_error() const noexcept {
+                return total.price.standard_error;
+            }
+        };
+
+        // Discounted expectation of one payoff
+        struct ExpectationResult {
+            MonteCarloResult<T> price;
+            size_t num_paths = 0;  // paths actually simulated
+            StopReason stop_reason = StopReason::PathBudget;
+
+            T max_standard_error() const noexcept {
+                return price.standard_error;
+            }
+        };
+
+        // Price and its sensitivity to every input, from one adjoint run
+        struct AdjointResult {
+            MonteCarloResult<T> price;
+            std::vector<MonteCarloResult<T>> sensitivities;  // ∂price/∂inputs[i]
+            size_t num_paths = 0;  // paths actually simulated
+            StopReason stop_reason = StopReason::PathBudget;
+
+            // Adaptive runs target the price error
+            T max_standard_error() const noexcept {
+                return price.standard_error;
+            }
+        };
+
+        // Least-squares Monte Carlo estimates of one American option
+        struct AmericanResult {
+            MonteCarloResult<T> price;      // independent paths under the fitted exercise rule (low-biased)
+            MonteCarloResult<T> in_sample;  // backward induction on the training paths
+            size_t training_paths = 0;
+            size_t pricing_paths = 0;
         };
 
         CallPutResult price_european_call_and_put(
             T S0, T K, T r, T sigma, T time
         ) const {
-            switch (config_.policy) {
-            case MonteCarloCreateInfo<T>::ExecutionPolicy::Sequential:
-                return price_european_call_and_put_sequential(S0, K, r, sigma, time);
+            // A 1 x 1 grid of the shared engine; the policy only picks seq or
+            // par chunks, so both policies give bit-identical results for the same seed
+            const std::array<T, 1> strikes{ K };
+            const std::array<T, 1> maturities{ time };
+            const GridResult grid = price_grid_chunked(S0, r, sigma, strikes, maturities);
 
-            case MonteCarloCreateInfo<T>::ExecutionPolicy::Parallel:
-                return price_european_call_and_put_parallel(S0, K, r, sigma, time);
+            return {
+                .call = grid.calls.front(),
+                .put = grid.puts.front(),
+                .num_paths = grid.num_paths,
+                .stop_reason = grid.stop_reason
+            };
+        }
 
-            case MonteCarloCreateInfo<T>::ExecutionPolicy::Auto:
-            default:
-                // Auto-decide based on simulation count
-                if (config_.num_simulations >= 10'000) {
-                    return price_european_call_and_put_parallel(S0, K, r, sigma, time);
-                }
-                return price_european_call_and_put_sequential(S0, K, r, sigma, time);
-            }
+        // Multi-step GBM paths on `times`, driven by this pricer's seed
+        GbmPathEngine<T> make_path_engine(T S0, T r, T sigma, std::vector<T> times) const {
+            return GbmPathEngine<T>({
+                .spot_price = S0,
+                .risk_free_rate = r,
+                .volatility = sigma,
+                .times = std::move(times)
+            }, config_.seed);
         }
 
-    private:
-        CallPutResult price_european_call_and_put_parallel(
-            T S0, T K, T r, T sigma, T time
+        // Heston QE paths on `times`, driven by this pricer's seed
+        HestonPathEngine<T> make_heston_engine(const model::HestonCreateInfo<T>& info, std::vector<T> times) const {
+            return HestonPathEngine<T>({
+                .spot_price = info.spot_price,
+                .risk_free_rate = info.risk_free_rate,
+                .initial_variance = info.initial_variance,
+                .long_run_variance = info.long_run_variance,
+                .mean_reversion = info.mean_reversion,
+                .vol_of_vol = info.vol_of_vol,
+                .correlation = info.correlation,
+                .times = std::move(times)
+            }, config_.seed);
+        }
+
+        // Exact-jump-time jump-diffusion paths on `times`, driven by this pricer's seed
+        template<typename Jumps>
+        JumpDiffusionPathEngine<T, Jumps> make_jump_diffusion_engine(
+            const model::JumpDiffusionCreateInfo<T, Jumps>& info,
+            std::vector<T> times
+        ) const {
+            return JumpDiffusionPathEngine<T, Jumps>({
+                .spot_price = info.spot_price,
+                .risk_free_rate = info.risk_free_rate,
+                .volatility = info.volatility,
+                .jump_intensity = info.jump_intensity,
+                .jumps = info.jumps,
+                .times = std::move(times)
+            }, config_.seed);
+        }
+
+        // Log-Euler local-vol paths on `times`, driven by this pricer's seed
+        LocalVolPathEngine<T> make_local_vol_engine(
+            const model::LocalVolSurface<T>& surface,
+            std::vector<T> times,
+            T max_step
+        ) const {
+            return LocalVolPathEngine<T>(surface, {
+                .times = std::move(times),
+                .max_step = max_step
+            }, config_.seed);
+        }
+
+        // Paths of a user-defined Itô SDE on `times`, driven by this pricer's seed
+        template<ItoScheme Scheme = ItoScheme::EulerMaruyama, typename Process>
+        ItoPathEngine<T, Process, Scheme> make_ito_engine(
+            const Process& process,
+            T initial_value,
+            std::vector<T> times,
+            T max_step
         ) const {
-            // Step 1: Pre-generate all random numbers (thread-safe)
-            std::vector<T> random_normals(config_.num_simulations);
+            return ItoPathEngine<T, Process, Scheme>(process, {
+                .initial_value = initial_value,
+                .times = std::move(times),
+                .max_step = max_step
+            }, config_.seed);
+        }
+
+        /**
+         * Discounted expectation E[payoff(X_T)] of an Itô SDE
+         * X_T comes from engine.terminal() (no path storage) inside the fused
+         * chunk kernel, sequential or parallel with bit-identical results;
+         * antithetic pairs drive -Z. payoff is any callable T(T), inlined into
+         * the loop. Antithetic and adaptive options apply; control_variate
+         * does not, and Sobol sampling is rejected (the engine draws its own
+         * Philox normals).
+         */
+        template<typename Process, ItoScheme Scheme, typename Payoff>
+        ExpectationResult price_ito_expectation(
+            const ItoPathEngine<T, Process, Scheme>& engine,
+            Payoff&& payoff,
+            T discount_factor = static_cast<T>(1)
+        ) const {
+            if (config_.sampling == Sampling::Sobol)
+                throw std::invalid_argument("Sobol sampling is not supported for Ito processes");
+
+            const bool antithetic = config_.antithetic;
+
+            return run<RunningStatistics<T>>(
+                [&](std::span<RunningStatistics<T>> replicates, size_t begin, size_t end) {
+                    simulate(replicates, begin, end, RunningStatistics<T>{},
+                        [&](RunningStatistics<T>& acc, size_t first, size_t count, size_t) {
+                            std::array<T, block_size> X, X_bar;
+                            engine.terminal(std::span<T>(X.data(), count), first, count);
+                            if (antithetic) {
+                                engine.terminal(std::span<T>(X_bar.data(), count), first, count, true);
+                            }
+                            for (size_t k{}; k < count; ++k) {
+                                acc.push(antithetic ? (payoff(X[k]) + payoff(X_bar[k])) / static_cast<T>(2) : payoff(X[k]));
+                            }
+                        });
+                },
+                [&](std::span<const RunningStatistics<T>> replicates) {
+                    return ExpectationResult{ .price = compute_statistics(replicates.front(), discount_factor) };
+                });
+        }
+
+        /**
+         * European call and put with pathwise delta, vega and rho in ONE pass
+         * Each Greek is the expectation of the derivative of the discounted
+         * payoff along the path S(T) = S0 exp((r - σ²/2) T + σ √T Z):
+         *     delta = e^(-rT) 1{S(T) > K} S(T) / S0
+         *     vega  = e^(-rT) 1{S(T) > K} S(T) (√T Z - σ T)
+         *     rho   = e^(-rT) 1{S(T) > K} K T
+         * (calls; puts flip the sign and the indicator). Every estimator is
+         * accumulated next to the price in the fused chunk kernel, so all
+         * first-order Greeks cost one simulation instead of a bump per Greek.
+         * Antithetic, control-variate (on S(T), for every estimator), Sobol and
+         * adaptive options apply as for price_european_call_and_put; an
+         * adaptive target applies to the price.
+         */
+        GreeksResult price_european_greeks(T S0, T K, T r, T sigma, T time) const {
+            if (!(sigma > 0))
+                throw std::invalid_argument("Volatility must be positive for pathwise Greeks");
+
+            const std::array<T, 1> strikes{ K };
+            const std::array<T, 1> maturities{ time };
+            const GbmGrid gbm = make_gbm(S0, r, sigma, maturities, strikes);
 
-            // Generate randoms sequentially (RNG is NOT thread-safe)
-            for (size_t i = 0; i < config_.num_simulations; ++i) {
-                random_normals[i] = normal_(rng_);
+            return run<GreekStatistics>(
+                [&](std::span<GreekStatistics> replicates, size_t begin, size_t end) {
+                    simulate(replicates, begin, end, GreekStatistics{},
+                        [&](GreekStatistics& acc, size_t first, size_t count, size_t replicate) {
+                            accumulate_greeks(acc, first, count, replicate, gbm, sigma, time);
+                        });
+                },
+                [&](std::span<const GreekStatistics> replicates) {
+                    return make_greeks_result(replicates, S0, r, time);
+                });
+        }
+
+        /**
+         * Price, delta and gamma of a book of European-style payoffs under GBM
+         * from ONE simulation, with standard errors per position and for the
+         * book total. With ζ = Z / (σ √T) the likelihood-ratio (score)
+         * weights of S(T) = S0 exp((r - σ²/2) T + σ √T Z) are
+         *     delta: ζ / S0,   gamma: (ζ² - 1/(σ²T) - ζ) / S0²
+         * and need no payoff derivative, so digitals and other discontinuous
+         * payoffs are handled (Broadie & Glasserman, 1996).
+         *   LikelihoodRatio - f(S(T)) times the weights
+         *   Mixed           - the payoff's smooth part pathwise (delta
+         *                     f'(S) S/S0, gamma by the score of that delta,
+         *                     f'(S) S/S0² (ζ - 1)), only the jump part by
+         *                     likelihood ratio: the same expectations, with a
+         *                     lower variance as long as the jump part is no
+         *                     larger than f (the splits in terminal_payoff.hpp
+         *                     are chosen so)
+         * Antithetic, Sobol and adaptive options apply (a target applies to
+         * the book total); control_variate does not.
+         */
+        template<TerminalPayoff<T> Payoff>
+        BookGreeksResult price_terminal_greeks(
+            T S0, T r, T sigma, T time,
+            std::span<const Payoff> book,
+            GreekEstimator estimator = GreekEstimator::Mixed
+        ) const {
+            if (book.empty())
+                throw std::invalid_argument("Book needs at least one position");
+            if (!(sigma > 0))
+                throw std::invalid_argument("Volatility must be positive for likelihood-ratio Greeks");
+            for (const Payoff& payoff : book) {
+                if constexpr (requires { payoff.validate(); }) payoff.validate();
             }
 
-            // Step 2: Compute terminal prices in parallel
-            std::vector<T> terminal_prices(config_.num_simulations);
+            const std::array<T, 1> maturities{ time };
+            const GbmGrid gbm = make_gbm(S0, r, sigma, maturities, {});
+            const BookStatistics empty{ std::vector<RunningStatistics<T>>(3 * (book.size() + 1)) };
 
-            // Precompute constants
-            const T drift = (r - (sigma * sigma) / static_cast<T>(2)) * time;
-            const T vol_sqrt_t = sigma * std::sqrt(time);
-
-            // PARALLEL TRANSFORM: Each thread computes S(T) independently
-            std::transform(
-                std::execution::par,  // ← PARALLEL!
-                random_normals.begin(),
-                random_normals.end(),
-                terminal_prices.begin(),
-                [S0, drift, vol_sqrt_t](T Z) {
-                    return S0 * std::exp(drift + vol_sqrt_t * Z);
-                }
-            );
-
-            // Step 3: Compute payoffs in parallel
-            std::vector<T> call_payoffs(config_.num_simulations);
-            std::vector<T> put_payoffs(config_.num_simulations);
-
-            std::transform(
-                std::execution::par,  // ← PARALLEL!
-                terminal_prices.begin(),
-                terminal_prices.end(),
-                call_payoffs.begin(),
-                [K](T ST) { return std::max(ST - K, T{}); }
-            );
-
-            std::transform(
-                std::execution::par,  // ← PARALLEL!
-                terminal_prices.begin(),
-                terminal_prices.end(),
-                put_payoffs.begin(),
-                [K](T ST) { return std::max(K - ST, T{}); }
-            );
-
-            // Step 4: Compute statistics (discount and return)
-            T DF = std::exp(-r * time);
+            return run<BookStatistics>(
+                [&](std::span<BookStatistics> replicates, size_t begin, size_t end) {
+                    simulate(replicates, begin, end, empty,
+                        [&](BookStatistics& acc, size_t first, size_t count, size_t replicate) {
+                            accumulate_book_greeks(acc, first, count, replicate, gbm, book, estimator);
+                        });
+                },
+                [&](std::span<const BookStatistics> replicates) {
+                    return make_book_result(replicates, r, time, book.size());
+                });
+        }
 
-            return {
-                .call = compute_statistics(call_payoffs, DF),
-                .put = compute_statistics(put_payoffs, DF)
+        /**
+         * Price and its sensitivity to EVERY input by adjoint (reverse-mode)
+         * differentiation along each path: the cost is a small multiple of one
+         * pricing however many inputs there are (vol surface nodes, curve
+         * points), where bumping and forward mode grow with their number.
+         *   setup(std::span<const math::Var<T>> inputs) -> state
+         *       whatever the paths share (drift and vol per step, discount
+         *       factors), computed from the inputs on the tape
+         *   payoff(const state&, std::span<const T> Z) -> math::Var<T>
+         *       discounted payoff of one path from its num_normals normals
+         *
+         *     pricer.price_adjoint(inputs, num_steps,
+         *         [&](auto x) { return make_steps(x); },
+         *         [&](const auto& steps, std::span<const double> Z) { ... });
+         *
+         * Pathwise checkpointing: per block of paths the inputs and setup are
+         * recorded once and marked; each path is then recorded, swept back to
+         * the mark (its adjoints pile up in the setup nodes) and rewound. A
+         * thread's tape therefore never holds more than the setup plus ONE
+         * path, and the setup is swept once per block. Each block gives its
+         * mean gradient, weighted by its path count, so the sensitivities
+         * average over every path as the price does; their standard errors
+         * come from the spread of the block means.
+         * Antithetic, Sobol (num_normals <= 21) and adaptive options apply (a
+         * target applies to the price); control_variate does not.
+         */
+        template<typename Setup, typename Payoff>
+            requires math::Scalar<T>
+        AdjointResult price_adjoint(
+            std::span<const T> inputs,
+            size_t num_normals,
+            Setup&& setup,
+            Payoff&& payoff
+        ) const {
+            if (num_normals == 0)
+                throw std::invalid_argument("Paths need at least one normal");
+            if (config_.sampling == Sampling::Sobol && num_normals > random::SobolSequence::max_dimensions)
+                throw std::invalid_argument("Sobol sampling supports at most 21 normals per path");
+
+            const AdjointStatistics empty{ .price = {}, .sensitivities = std::vector<BatchStatistics<T>>(inputs.size()) };
+
+            return run<AdjointStatistics>(
+                [&](std::span<AdjointStatistics> replicates, size_t begin, size_t end) {
+                    simulate(replicates, begin, end, empty,
+                        [&](AdjointStatistics& acc, size_t first, size_t count, size_t replicate) {
+                            accumulate_adjoint(acc, first, count, replicate, inputs, num_normals, setup, payoff);
+                        });
+                },
+                [&](std::span<const AdjointStatistics> replicates) {
+                    return make_adjoint_result(replicates);
+                });
+        }
+
+        /**
+         * Price every (maturity, strike) pair from ONE set of paths
+         * Each path is simulated once and sampled at every maturity (strictly
+         * increasing), so a 40 x 12 chain costs one simulation, and common
+         * random numbers keep the smile and term structure consistent.
+         * Antithetic, control-variate, Sobol and adaptive options apply to every
+         * cell; an adaptive target must be met by the worst cell.
+         */
+        GridResult price_european_grid(
+            T S0, T r, T sigma,
+            std::span<const T> strikes,
+            std::span<const T> maturities
+        ) const {
+            return price_grid_chunked(S0, r, sigma, strikes, maturities);
+        }
+
+        /**
+         * Arithmetic-average Asian call and put on a discrete fixing schedule
+         * Payoffs max(A - K, 0) and max(K - A, 0) at the last fixing, with
+         * A = mean of S(t_i). The closed-form geometric Asian is a built-in
+         * control variate: each payoff is regressed on the matching geometric
+         * payoff, whose expectation is known exactly (GeometricAsianModel).
+         * Antithetic, Sobol (up to 21 fixings) and adaptive options apply.
+         */
+        CallPutResult price_asian_call_and_put(
+            T S0, T K, T r, T sigma,
+            std::span<const T> fixing_times
+        ) const {
+            const model::GeometricAsianModel<T> geometric({
+                .spot_price = S0,
+                .strike_price = K,
+                .risk_free_rate = r,
+                .volatility = sigma,
+                .fixing_times = std::vector<T>(fixing_times.begin(), fixing_times.end())
+            });
+            return price_asian_chunked(S0, K, r, sigma, fixing_times, geometric);
+        }
+
+        /**
+         * Continuously monitored single-barrier call and put (no rebate)
+         * Paths are simulated on `num_steps` equal steps. Between two steps the
+         * Brownian bridge gives the exact probability that the path touched H,
+         *     p = exp(-2 ln(S_i/H) ln(S_i+1/H) / (σ² Δt)),
+         * and each payoff is weighted by the survival probability (knock-out)
+         * or its complement (knock-in), so a coarse grid carries no monitoring
+         * bias. bridge_correction = false monitors the grid dates only
+         * (a discretely monitored barrier). control_variate regresses on S(T)
+         * as for Europeans; model::BarrierModel is the closed-form reference.
+         */
+        CallPutResult price_barrier_call_and_put(
+            const model::BarrierCreateInfo<T>& info,
+            size_t num_steps,
+            bool bridge_correction = true
+        ) const {
+            info.validate();
+            return price_barrier_chunked(info, num_steps, bridge_correction);
+        }
+
+        /**
+         * European call and put under Heston, QE scheme on `num_steps` equal steps
+         * Same fused chunk pipeline as the GBM engine (sequential or parallel,
+         * bit-identical); step s uses normal dimensions 2s (variance) and
+         * 2s + 1 (price). control_variate regresses on S(T), whose expectation
+         * S0 e^(rT) holds under Heston. Antithetic, Sobol (up to 10 steps) and
+         * adaptive options apply; model::HestonModel is the Fourier reference.
+         */
+        CallPutResult price_heston_call_and_put(const model::HestonCreateInfo<T>& info, size_t num_steps) const {
+            info.validate();
+            if (config_.sampling == Sampling::Sobol && 2 * num_steps > random::SobolSequence::max_dimensions)
+                throw std::invalid_argument("Sobol sampling supports at most 10 Heston steps");
+
+            const HestonPathEngine<T> engine = make_heston_engine(info, uniform_time_grid(info.time_to_maturity, num_steps));
+
+            return run<CallPutStatistics>(
+                [&](std::span<CallPutStatistics> replicates, size_t begin, size_t end) {
+                    simulate(replicates, begin, end, CallPutStatistics{},
+                        [&](CallPutStatistics& acc, size_t first, size_t count, size_t replicate) {
+                            accumulate_heston(acc, first, count, replicate, engine, info.strike_price);
+                        });
+                },
+                [&](std::span<const CallPutStatistics> replicates) {
+                    return make_result(replicates, info.spot_price, info.risk_free_rate, info.time_to_maturity);
+                });
+        }
+
+        /**
+         * European call and put under a jump diffusion (Merton or Kou jumps)
+         * Exact simulation to maturity: one diffusion normal plus exact Poisson
+         * arrivals from JumpDiffusionPathEngine, so there is no time step and
+         * no discretization bias. control_variate regresses on S(T), whose
+         * expectation S0 e^(rT) holds with compensated jumps. Antithetic
+         * mirrors the diffusion only; Sobol is not supported (the number of
+         * draws per path is random). model::MertonModel / KouModel are the
+         * closed-form references.
+         */
+        template<typename Jumps>
+        CallPutResult price_jump_diffusion_call_and_put(const model::JumpDiffusionCreateInfo<T, Jumps>& info) const {
+            info.validate();
+            if (config_.sampling == Sampling::Sobol)
+                throw std::invalid_argument("Sobol sampling is not supported for jump diffusions");
+
+            const JumpDiffusionPathEngine<T, Jumps> engine = make_jump_diffusion_engine(info, { info.time_to_maturity });
+
+            return run<CallPutStatistics>(
+                [&](std::span<CallPutStatistics> replicates, size_t begin, size_t end) {
+                    simulate(replicates, begin, end, CallPutStatistics{},
+                        [&](CallPutStatistics& acc, size_t first, size_t count, size_t replicate) {
+                            accumulate_jump_diffusion(acc, first, count, replicate, engine, info.strike_price);
+                        });
+                },
+                [&](std::span<const CallPutStatistics> replicates) {
+                    return make_result(replicates, info.spot_price, info.risk_free_rate, info.time_to_maturity);
+                });
+        }
+
+        /**
+         * European call and put under a local-volatility surface
+         * Log-Euler on `num_steps` equal steps to T (LocalVolPathEngine); step e
+         * uses normal dimension e and one σ_loc row lookup per path. With a
+         * surface built from market implied vols, the prices reproduce the
+         * input smile up to Euler and grid error. control_variate regresses on
+         * S(T), whose expectation S0 e^(rT) holds exactly under log-Euler.
+         * Antithetic, Sobol (up to 21 steps) and adaptive options apply.
+         */
+        CallPutResult price_local_vol_call_and_put(
+            const model::LocalVolSurface<T>& surface,
+            T K,
+            T time_to_maturity,
+            size_t num_steps
+        ) const {
+            if (K <= 0)
+                throw std::invalid_argument("Strike price must be positive");
+            if (time_to_maturity <= 0)
+                throw std::invalid_argument("Time to maturity must be positive");
+            if (num_steps == 0)
+                throw std::invalid_argument("Number of steps must be positive");
+            if (config_.sampling == Sampling::Sobol && num_steps > random::SobolSequence::max_dimensions)
+                throw std::invalid_argument("Sobol sampling supports at most 21 local-vol steps");
+
+            const LocalVolPathEngine<T> engine = make_local_vol_engine(surface, { time_to_maturity },
+                time_to_maturity / static_cast<T>(num_steps));
+
+            return run<CallPutStatistics>(
+                [&](std::span<CallPutStatistics> replicates, size_t begin, size_t end) {
+                    simulate(replicates, begin, end, CallPutStatistics{},
+                        [&](CallPutStatistics& acc, size_t first, size_t count, size_t replicate) {
+                            accumulate_local_vol(acc, first, count, replicate, engine, K);
+                        });
+                },
+                [&](std::span<const CallPutStatistics> replicates) {
+                    return make_result(replicates, surface.spot_price(), surface.risk_free_rate(), time_to_maturity);
+                });
+        }
+
+        /**
+         * Multi-asset European call and put on a basket, best-of or worst-of
+         * Correlated terminal prices come from CorrelatedGbm (Cholesky, or PCA
+         * with info.num_factors); the normal of factor j is counter dimension j.
+         * Basket weights default to 1/n and are ignored by best-of/worst-of.
+         * control_variate regresses on the weighted basket Σ w_i S_i(T), whose
+         * expectation Σ w_i S_i e^(rT) is known. Antithetic, Sobol (up to 21
+         * factors) and adaptive options apply.
+         */
+        CallPutResult price_multi_asset_call_and_put(
+            const MultiAssetCreateInfo<T>& info,
+            MultiAssetPayoff payoff,
+            T K,
+            std::span<const T> weights = {}
+        ) const {
+            const CorrelatedGbm<T> model(info);
+            const size_t n = info.num_assets();
+            if (!weights.empty() && weights.size() != n)
+                throw std::invalid_argument("Basket weights must match the number of underlyings");
+            if (config_.sampling == Sampling::Sobol && model.num_factors() > random::SobolSequence::max_dimensions)
+                throw std::invalid_argument("Sobol sampling supports at most 21 factors");
+
+            const std::vector<T> w = weights.empty()
+                ? std::vector<T>(n, static_cast<T>(1) / static_cast<T>(n))
+                : std::vector<T>(weights.begin(), weights.end());
+            return price_multi_asset_chunked(info, model, payoff, K, w);
+        }
+
+        /**
+         * American option by least-squares Monte Carlo (Longstaff & Schwartz, 2001)
+         * Exercise is allowed on info.exercise_times (a Bermudan schedule; a fine
+         * grid approximates the American).
+         *   Backward pass - num_simulations stored paths; at each date the
+         *                   discounted cash flow of in-the-money paths is
+         *                   regressed on basis(S/K) via blocked normal equations.
+         *   Second pass   - the fitted rule exercises `pricing_paths` independent
+         *                   paths (0 = num_simulations): no foresight, biased low.
+         * Both passes run chunk by chunk, sequential or parallel, with
+         * bit-identical results. Antithetic, control-variate, Sobol and adaptive
+         * settings do not apply.
+         */
+        template<RegressionBasis<T> Basis = PolynomialBasis<T>>
+        AmericanResult price_american(
+            const AmericanCreateInfo<T>& info,
+            const Basis& basis = {},
+            size_t pricing_paths = 0
+        ) const {
+            info.validate();
+            return price_american_lsm(info, basis, pricing_paths > 0 ? pricing_paths : config_.num_simulations);
+        }
+
+        /**
+         * Multilevel Monte Carlo driver (Giles, 2008)
+         * Level l estimates E[P_l - P_l-1] with base_steps * 2^l fine steps,
+         * P_l and P_l-1 coupled on the same Brownian path. Samples per level
+         * follow N_l ∝ √(V_l / C_l) from the observed variances so that
+         * Σ V_l / N_l = ε²/2; levels are added while the extrapolated bias of
+         * the finest one exceeds ε/√2. Every sweep runs all pending (level,
+         * chunk) items at once, sequential or parallel, bit-identical.
+         *
+         * sampler(RunningStatistics<T>& acc, size_t level, size_t first,
+         * size_t count) pushes the corrections of samples [first, first + count)
+         * of `level` (count <= 16384). If it has prepare(size_t num_levels), that
+         * is called before a sweep that reaches a new level.
+         */
+        template<typename Sampler>
+        MultilevelResult<T> price_multilevel(const MultilevelCreateInfo<T>& info, Sampler&& sampler) const {
+            info.validate();
+
+            std::vector<RunningStatistics<T>> stats(info.min_levels);
+            std::vector<size_t> extra(info.min_levels, info.initial_samples);
+            std::vector<T> means;
+            std::vector<T> variances;
+            std::vector<T> costs;
+            const auto level_cost = [&](size_t l) {
+                return static_cast<T>((info.base_steps << l) + (l == 0 ? 0 : info.base_steps << (l - 1)));
             };
+            for (size_t l{}; l < info.min_levels; ++l) costs.push_back(level_cost(l));
+
+            T bias{};
+            bool converged = true;
+            while (std::any_of(extra.begin(), extra.end(), [](size_t n) { return n > 0; })) {
+                // Step 1 - One sweep over the missing samples of every level
+                if constexpr (requires { sampler.prepare(stats.size()); }) {
+                    sampler.prepare(stats.size());
+                }
+                sample_levels(stats, extra, sampler);
+
+                // Step 2 - Observed means and variances; weak and strong rates
+                const size_t L = stats.size();
+                means.resize(L);
+                variances.resize(L);
+                for (size_t l{}; l < L; ++l) {
+                    means[l] = stats[l].mean();
+                    variances[l] = stats[l].variance();
+                }
+                const T alpha = multilevel_decay_rate(std::span<const T>(means));
+                const T beta = multilevel_decay_rate(std::span<const T>(variances));
+
+                // Guard against a noisy small variance on the finer levels
+                for (size_t l = 2; l < L; ++l) {
+                    variances[l] = std::max(variances[l], variances[l - 1] / (static_cast<T>(2) * std::exp2(beta)));
+                }
+
+                // Step 3 - Optimal samples per level
+                update_extra_samples(stats, variances, costs, info.target_rmse, extra);
+
+                // Step 4 - Nearly there: test the bias of the finest level, add one if needed
+                bool settled = true;
+                for (size_t l{}; l < L; ++l) {
+                    settled = settled && static_cast<T>(extra[l]) <= static_cast<T>(0.01) * static_cast<T>(stats[l].count());
+                }
+                if (settled) {
+                    bias = T{};
+                    for (size_t i{}; i < std::min<size_t>(3, L - 1); ++i) {
+                        bias = std::max(bias, std::abs(means[L - 1 - i]) / std::exp2(alpha * static_cast<T>(i)));
+                    }
+                    bias /= std::exp2(alpha) - static_cast<T>(1);
+
+                    converged = bias <= info.target_rmse / std::numbers::sqrt2_v<T>;
+                    if (!converged && L < info.max_levels) {
+                        stats.emplace_back();
+                        extra.push_back(0);
+                        variances.push_back(variances.back() / std::exp2(beta));
+                        costs.push_back(level_cost(L));
+                        update_extra_samples(stats, variances, costs, info.target_rmse, extra);
+                    }
+                }
+            }
+
+            // Step 5 - Telescoping sum
+            MultilevelResult<T> result{ .price = T{}, .standard_error = T{}, .bias = bias, .converged = converged, .levels = {} };
+            T variance{};
+            for (size_t l{}; l < stats.size(); ++l) {
+                result.price += stats[l].mean();
+                variance += stats[l].variance() / static_cast<T>(stats[l].count());
+                result.levels.push_back({
+                    .num_steps = info.base_steps << l,
+                    .num_samples = stats[l].count(),
+                    .mean = stats[l].mean(),
+                    .variance = stats[l].variance(),
+                    .cost = costs[l]
+                });
+            }
+            result.standard_error = std::sqrt(variance);
+            return result;
         }
 
-        // Price both call and put using the SAME simulated paths
-        CallPutResult price_european_call_and_put_sequential(
-            T S0,
+        /**
+         * Arithmetic Asian option on the continuous average by MLMC, under a
+         * local-vol surface (a flat surface is GBM)
+         * Level l runs LocalVolPathEngine with base_steps * 2^l log-Euler steps
+         * and averages S by the trapezoid rule; the coarse path is driven by
+         * the pairwise sums (Z_2i + Z_2i+1) / √2 of the fine normals.
+         */
+        MultilevelResult<T> price_asian_multilevel(
+            const model::LocalVolSurface<T>& surface,
             T K,
-            T r,
-            T sigma,
-            T time
+            T time_to_maturity,
+            OptionType type,
+            const MultilevelCreateInfo<T>& info
+        ) const {
+            if (K <= 0)
+                throw std::invalid_argument("Strike price must be positive");
+            if (time_to_maturity <= 0)
+                throw std::invalid_argument("Time to maturity must be positive");
+
+            LocalVolLevelSampler sampler(*this, surface, time_to_maturity, info.base_steps, {
+                .K = K,
+                .call = type == OptionType::Call,
+                .asian = true
+            });
+            return price_multilevel(info, sampler);
+        }
+
+        /**
+         * Continuously monitored single-barrier option by MLMC, under a
+         * local-vol surface (a flat surface is GBM)
+         * Each fine step weights the path by its Brownian-bridge survival
+         * probability with the step's local vol. The coarse step uses the
+         * same bridge on both halves, through the midpoint implied by the fine
+         * increments (Giles, 2008), which keeps V_l decaying faster than the
+         * cost grows. Time steps come from the engine as for the Asian.
+         */
+        MultilevelResult<T> price_barrier_multilevel(
+            const model::LocalVolSurface<T>& surface,
+            T K,
+            T barrier,
+            model::BarrierType barrier_type,
+            T time_to_maturity,
+            OptionType type,
+            const MultilevelCreateInfo<T>& info
         ) const {
-            std::vector<T> call_payoffs;
-            std::vector<T> put_payoffs;
-            call_payoffs.reserve(config_.num_simulations);
-            put_payoffs.reserve(config_.num_simulations);
+            if (K <= 0 || barrier <= 0)
+                throw std::invalid_argument("Strike and barrier must be positive");
+            if (time_to_maturity <= 0)
+                throw std::invalid_argument("Time to maturity must be positive");
+
+            const bool down = barrier_type == model::BarrierType::DownAndOut || barrier_type == model::BarrierType::DownAndIn;
+            LocalVolLevelSampler sampler(*this, surface, time_to_maturity, info.base_steps, {
+                .K = K,
+                .call = type == OptionType::Call,
+                .asian = false,
+                .log_spot_to_barrier = std::log(surface.spot_price() / barrier),
+                .down = down,
+                .knock_out = barrier_type == model::BarrierType::DownAndOut || barrier_type == model::BarrierType::UpAndOut
+            });
+            return price_multilevel(info, sampler);
+        }
+
+    private:
+        using Policy = typename MonteCarloCreateInfo<T>::ExecutionPolicy;
+        using Sampling = typename MonteCarloCreateInfo<T>::Sampling;
+
+        // Paths per parallel work item: large enough to amortize scheduling,
+        // small enough that the chunk's working set stays in L1/L2
+        static constexpr size_t chunk_size = 16'384;
+
+        // Normals buffered per inner block of a chunk (fits in L1)
+        static constexpr size_t block_size = 256;
+
+        // Chunk accumulators alive at once in simulate(): bounds its memory
+        // independently of the path count
+        static constexpr size_t max_partials = 64;
+
+        // Philox counter space for the Sobol digital shifts
+        static constexpr std::uint32_t sobol_space = 2;
+
+        bool use_parallel() const noexcept {
+            switch (config_.policy) {
+            case Policy::Sequential:
+                return false;
+            case Policy::Parallel:
+                return true;
+            case Policy::Auto:
+            default:
+                return config_.num_simulations >= 10'000;
+            }
+        }
+
+        bool is_adaptive() const noexcept {
+            return config_.target_standard_error > 0 || config_.max_wall_time.count() > 0;
+        }
+
+        // Run kernel(acc, chunk_index) over every chunk accumulator
+        template<typename Accumulator, typename Kernel>
+        void for_each_chunk(std::vector<Accumulator>& partials, Kernel&& kernel) const {
+            auto body = [&kernel, first = partials.data()](Accumulator& acc) {
+                kernel(acc, static_cast<size_t>(&acc - first));
+            };
+            if (use_parallel()) {
+                std::for_each(std::execution::par, partials.begin(), partials.end(), body);
+            }
+            else {
+                std::for_each(std::execution::seq, partials.begin(), partials.end(), body);
+            }
+        }
+
+        // Paths behind one sample of every replicate
+        // (antithetic pairs count once: the standard error is taken on pair averages)
+        size_t paths_per_sample() const noexcept {
+            return num_replicates() * (config_.antithetic ? 2 : 1);
+        }
+
+        // Samples per replicate covering num_simulations paths (rounded up)
+        size_t num_samples() const noexcept {
+            return (config_.num_simulations + paths_per_sample() - 1) / paths_per_sample();
+        }
+
+        // Samples per replicate that fit in max_paths (rounded down, at least one)
+        size_t max_samples() const noexcept {
+            return std::max<size_t>(config_.max_paths / paths_per_sample(), 1);
+        }
+
+        // Independent estimates the samples are split across (Sobol shifts, else one stream)
+        size_t num_replicates() const noexcept {
+            return config_.sampling == Sampling::Sobol ? config_.num_randomizations : 1;
+        }
+
+        // Paths behind `samples` samples of every replicate
+        size_t paths_for(size_t samples) const noexcept {
+            return samples * paths_per_sample();
+        }
+
+        // Call and put statistics of the same paths; mergeable per chunk
+        struct CallPutStatistics {
+            RunningStatistics<T> call;
+            RunningStatistics<T> put;
+            ControlVariateStatistics<T, 1> call_cv;  // only filled with control_variate
+            ControlVariateStatistics<T, 1> put_cv;
+
+            void push(T call_payoff, T put_payoff, T control, bool control_variate) noexcept {
+                if (control_variate) {
+                    call_cv.push(call_payoff, { control });
+                    put_cv.push(put_payoff, { control });
+                }
+                else {
+                    call.push(call_payoff);
+                    put.push(put_payoff);
+                }
+            }
+
+            void merge(const CallPutStatistics& other) noexcept {
+                call.merge(other.call);
+                put.merge(other.put);
+                call_cv.merge(other.call_cv);
+                put_cv.merge(other.put_cv);
+            }
+        };
 
-            for (size_t i{}; i < config_.num_simulations; ++i) {
-                // Simulate terminal price ONCE
-                T ST = simulate_gbm_terminal(S0, r, sigma, time);
+        // Call and put statistics of every grid cell (maturity-major); mergeable per chunk
+        struct GridStatistics {
+            std::vector<CallPutStatistics> cells;
 
-                // Compute BOTH payoffs from the SAME simulated price
-                call_payoffs.push_back(std::max(ST - K, T{}));
-                put_payoffs.push_back(std::max(K - ST, T{}));
+            void merge(const GridStatistics& other) {
+                if (cells.empty()) {
+                    cells = other.cells;
+                    return;
+                }
+                for (size_t c{}; c < cells.size(); ++c) {
+                    cells[c].merge(other.cells[c]);
+                }
+            }
+        };
+
+        // Price, delta, vega and rho estimators of the call and put
+        struct GreekStatistics {
+            std::array<CallPutStatistics, 4> values;
+
+            void merge(const GreekStatistics& other) noexcept {
+                for (size_t g{}; g < values.size(); ++g) {
+                    values[g].merge(other.values[g]);
+                }
+            }
+        };
+
+        // Price, delta and gamma estimators of every position, then the book total
+        struct BookStatistics {
+            std::vector<RunningStatistics<T>> values;
+
+            void merge(const BookStatistics& other) {
+                if (values.empty()) {
+                    values = other.values;
+                    return;
+                }
+                for (size_t i{}; i < values.size(); ++i) {
+                    values[i].merge(other.values[i]);
+                }
+            }
+        };
+
+        // Price over paths, then one block-mean gradient estimator per adjoint input
+        struct AdjointStatistics {
+            RunningStatistics<T> price;
+            std::vector<BatchStatistics<T>> sensitivities;
+
+            void merge(const AdjointStatistics& other) {
+                price.merge(other.price);
+                if (sensitivities.empty()) {
+                    sensitivities = other.sensitivities;
+                    return;
+                }
+                for (size_t i{}; i < sensitivities.size(); ++i) {
+                    sensitivities[i].merge(other.sensitivities[i]);
+                }
+            }
+        };
+
+        // Arithmetic-average payoffs regressed on the geometric-average payoffs
+        struct AsianStatistics {
+            ControlVariateStatistics<T, 1> call;
+            ControlVariateStatistics<T, 1> put;
+
+            void merge(const AsianStatistics& other) noexcept {
+                call.merge(other.call);
+                put.merge(other.put);
+            }
+        };
+
+        // Barrier monitoring constants, in log-distance to the barrier a = ln(S/H)
+        struct BarrierSpec {
+            T K;
+            T log_spot_to_barrier;  // a at t = 0
+            bool down;
+            bool knock_out;
+            bool bridge_correction;
+        };
+
+        // Precomputed GBM map between consecutive observation times:
+        // S(t_j) = S(t_j-1) * exp(drift[j] + vol[j] * Z_j), t_-1 = 0
+        struct GbmGrid {
+            T S0;
+            std::vector<T> drift;
+            std::vector<T> vol;
+            std::span<const T> strikes;
+        };
+
+        // Validate the observation times and precompute the step constants
+        GbmGrid make_gbm(T S0, T r, T sigma, std::span<const T> times, std::span<const T> strikes) const {
+            if (times.empty())
+                throw std::invalid_argument("Needs at least one observation time");
+            if (config_.sampling == Sampling::Sobol && times.size() > random::SobolSequence::max_dimensions)
+                throw std::invalid_argument("Sobol sampling supports at most 21 observation times");
+
+            GbmGrid gbm{ .S0 = S0, .drift = {}, .vol = {}, .strikes = strikes };
+            for (size_t m{}; m < times.size(); ++m) {
+                const T previous = m == 0 ? T{} : times[m - 1];
+                if (!(times[m] > previous))
+                    throw std::invalid_argument("Observation times must be positive and strictly increasing");
+
+                const T dt = times[m] - previous;
+                using std::sqrt;
+                gbm.drift.push_back((r - (sigma * sigma) / static_cast<T>(2)) * dt);
+                gbm.vol.push_back(sigma * sqrt(dt));
             }
+            return gbm;
+        }
+
+        // Discounted call/put estimates of one cell from per-replicate statistics
+        CallPutResult make_result(std::span<const CallPutStatistics> replicates, T S0, T r, T time) const {
+            using std::exp;
+            T DF = exp(-r * time);
+            const T expected_ST = S0 / DF;  // E[S(T)] = S0 * e^(rT)
+
+            if (replicates.size() == 1) {
+                const CallPutStatistics& stats = replicates.front();
+                if (config_.control_variate) {
+                    return {
+                        .call = compute_statistics(stats.call_cv, expected_ST, DF),
+                        .put = compute_statistics(stats.put_cv, expected_ST, DF)
+                    };
+                }
+                return {
+                    .call = compute_statistics(stats.call, DF),
+                    .put = compute_statistics(stats.put, DF)
+                };
+            }
+
+            // Randomized QMC: each replicate is an independent unbiased estimate
+            RunningStatistics<T> call_estimates;
+            RunningStatistics<T> put_estimates;
+
+            for (const CallPutStatistics& stats : replicates) {
+                if (config_.control_variate) {
+                    call_estimates.push(stats.call_cv.mean({ expected_ST }));
+                    put_estimates.push(stats.put_cv.mean({ expected_ST }));
+                }
+                else {
+                    call_estimates.push(stats.call.mean());
+                    put_estimates.push(stats.put.mean());
+                }
+            }
+
+            return {
+                .call = compute_statistics(call_estimates, DF),
+                .put = compute_statistics(put_estimates, DF)
+            };
+        }
 
-            // Discount factor
-            T DF = std::exp(-r * time);
+        // Discounted price and Greek estimates; each estimator is finished
+        // like a price (control variate, randomized QMC)
+        GreeksResult make_greeks_result(std::span<const GreekStatistics> replicates, T S0, T r, T time) const {
+            std::array<CallPutResult, 4> estimates;
+            std::vector<CallPutStatistics> greek(replicates.size());
+            for (size_t g{}; g < estimates.size(); ++g) {
+                for (size_t s{}; s < replicates.size(); ++s) {
+                    greek[s] = replicates[s].values[g];
+                }
+                estimates[g] = make_result(greek, S0, r, time);
+            }
 
-            // Return both results
             return {
-                .call = compute_statistics(call_payoffs, DF),
-                .put = compute_statistics(put_payoffs, DF)
+                .call = { estimates[0].call, estimates[1].call, estimates[2].call, estimates[3].call },
+                .put = { estimates[0].put, estimates[1].put, estimates[2].put, estimates[3].put }
             };
         }
+
+        // Discounted book estimates; randomized QMC takes the error across replicates
+        BookGreeksResult make_book_result(std::span<const BookStatistics> replicates, T r, T time, size_t num_positions) const {
+            const T DF = std::exp(-r * time);
+            const auto estimate = [&](size_t i) {
+                if (replicates.size() == 1) {
+                    return compute_statistics(replicates.front().values[i], DF);
+                }
+                RunningStatistics<T> estimates;
+                for (const BookStatistics& stats : replicates) {
+                    estimates.push(stats.values[i].mean());
+                }
+                return compute_statistics(estimates, DF);
+            };
+            const auto greeks = [&](size_t j) {
+                return TerminalGreeks{ estimate(3 * j), estimate(3 * j + 1), estimate(3 * j + 2) };
+            };
+
+            BookGreeksResult result{ .positions = {}, .total = greeks(num_positions) };
+            for (size_t j{}; j < num_positions; ++j) {
+                result.positions.push_back(greeks(j));
+            }
+            return result;
+        }
+
+        // Adjoint estimates (the payoffs are already discounted)
+        AdjointResult make_adjoint_result(std::span<const AdjointStatistics> replicates) const {
+            const auto estimate = [&](const auto& select) {
+                if (replicates.size() == 1) {
+                    return compute_statistics(select(replicates.front()), static_cast<T>(1));
+                }
+                RunningStatistics<T> estimates;
+                for (const AdjointStatistics& stats : replicates) {
+                    estimates.push(select(stats).mean());
+                }
+                return compute_statistics(estimates, static_cast<T>(1));
+            };
+
+            AdjointResult result{
+                .price = estimate([](const AdjointStatistics& stats) -> const auto& { return stats.price; }),
+                .sensitivities = {}
+            };
+            for (size_t i{}; i < replicates.front().sensitivities.size(); ++i) {
+                result.sensitivities.push_back(
+                    estimate([i](const AdjointStatistics& stats) -> const auto& { return stats.sensitivities[i]; }));
+            }
+            return result;
+        }
+
+        // Discounted estimates of every cell
+        GridResult make_grid_result(
+            std::span<const GridStatistics> replicates,
+            T S0, T r,
+            std::span<const T> maturities,
+            size_t num_strikes
+        ) const {
+            GridResult result{ .calls = {}, .puts = {}, .num_strikes = num_strikes };
+            result.calls.reserve(maturities.size() * num_strikes);
+            result.puts.reserve(maturities.size() * num_strikes);
+
+            std::vector<CallPutStatistics> cell(replicates.size());
+            for (size_t m{}; m < maturities.size(); ++m) {
+                for (size_t k{}; k < num_strikes; ++k) {
+                    for (size_t s{}; s < replicates.size(); ++s) {
+                        cell[s] = replicates[s].cells[m * num_strikes + k];
+                    }
+                    const CallPutResult cell_result = make_result(cell, S0, r, maturities[m]);
+                    result.calls.push_back(cell_result.call);
+                    result.puts.push_back(cell_result.put);
+                }
+            }
+            return result;
+        }
+
+        // Discounted Asian estimates; the geometric payoffs have known means
+        CallPutResult make_asian_result(
+            std::span<const AsianStatistics> replicates,
+            const model::GeometricAsianModel<T>& geometric,
+            T r
+        ) const {
+            const T DF = std::exp(-r * geometric.maturity());
+            const T expected_call = geometric.expected_call_payoff();
+            const T expected_put = geometric.expected_put_payoff();
+
+            if (replicates.size() == 1) {
+                return {
+                    .call = compute_statistics(replicates.front().call, expected_call, DF),
+                    .put = compute_statistics(replicates.front().put, expected_put, DF)
+                };
+            }
+
+            // Randomized QMC: each replicate is an independent unbiased estimate
+            RunningStatistics<T> call_estimates;
+            RunningStatistics<T> put_estimates;
+
+            for (const AsianStatistics& stats : replicates) {
+                call_estimates.push(stats.call.mean({ expected_call }));
+                put_estimates.push(stats.put.mean({ expected_put }));
+            }
+
+            return {
+                .call = compute_statistics(call_estimates, DF),
+                .put = compute_statistics(put_estimates, DF)
+            };
+        }
+
+        // Philox counter space for the Sobol digital shifts: one word per (replicate, dimension)
+        std::uint32_t sobol_shift(size_t replicate, std::uint32_t dimension) const noexcept {
+            return random::Philox4x32(config_.seed)({ static_cast<std::uint32_t>(replicate), dimension, 0, sobol_space })[0];
+        }
+
+        // Normals of samples [first, first + Z.size()) of one replicate, for one
+        // time step (`dimension`). Every draw is a pure function of
+        // (seed, replicate, dimension, index), so any split of the sample range
+        // into chunks or batches sees the same paths.
+        void fill_normals(std::span<math::scalar_t<T>> Z, size_t first, size_t replicate, std::uint32_t dimension) const {
+            using Real = math::scalar_t<T>;
+            if (config_.sampling == Sampling::Sobol) {
+                const std::uint32_t shift = sobol_shift(replicate, dimension);
+                std::uint32_t x = sobol_(first, dimension);
+                for (size_t k{}; k < Z.size(); ++k) {
+                    Z[k] = math::inverse_normal_cdf(random::SobolSequence::to_unit_interval<Real>(x ^ shift));
+                    x = sobol_.next(x, first + k, dimension);
+                }
+                return;
+            }
+
+            // Vectorized batch: SIMD Philox + tiled Box-Muller
+            stream_.fill_normal(Z, first, dimension);
+        }
+
+        // Number types (e.g. Dual): the draws depend on no input, so they are
+        // made as scalars and widened with zero tangents
+        void fill_normals(std::span<T> Z, size_t first, size_t replicate, std::uint32_t dimension) const
+            requires (!math::Scalar<T>)
+        {
+            std::array<math::scalar_t<T>, block_size> z;
+            for (size_t b{}; b < Z.size(); b += block_size) {
+                const size_t n = std::min(block_size, Z.size() - b);
+                fill_normals(std::span(z.data(), n), first + b, replicate, dimension);
+                std::copy_n(z.begin(), n, Z.begin() + b);
+            }
+        }
+
+        // Evolve a block of samples through every maturity, pay off each strike
+        // and accumulate - PRIVATE helper (count <= block_size)
+        void accumulate_paths(
+            GridStatistics& acc,
+            size_t first,
+            size_t count,
+            size_t replicate,
+            const GbmGrid& gbm
+        ) const {
+            const bool antithetic = config_.antithetic;
+            const bool control_variate = config_.control_variate;
+            const size_t num_strikes = gbm.strikes.size();
+
+            std::array<T, block_size> Z;
+            std::array<T, block_size> X{};      // log-return to the current maturity
+            std::array<T, block_size> X_bar{};  // same for the mirror path -Z
+            std::array<T, block_size> ST;
+            std::array<T, block_size> ST_bar;
+
+            for (size_t m{}; m < gbm.drift.size(); ++m) {
+                // Step 1 - Increments to maturity m from their own normal dimension
+                fill_normals(std::span<T>(Z.data(), count), first, replicate, static_cast<std::uint32_t>(m));
+                for (size_t k{}; k < count; ++k) {
+                    X[k] += gbm.drift[m] + gbm.vol[m] * Z[k];
+                    X_bar[k] += gbm.drift[m] - gbm.vol[m] * Z[k];
+                }
+
+                // Step 2 - One SIMD exp pass per block instead of a libm call per path
+                math::vexp(std::span<const T>(X.data(), count), std::span<T>(ST.data(), count));
+                if (antithetic) {
+                    math::vexp(std::span<const T>(X_bar.data(), count), std::span<T>(ST_bar.data(), count));
+                }
+
+                // Step 3 - Payoffs of every strike at this maturity
+                CallPutStatistics* row = acc.cells.data() + m * num_strikes;
+                for (size_t k{}; k < count; ++k) {
+                    const T S = gbm.S0 * ST[k];
+                    const T S_bar = antithetic ? gbm.S0 * ST_bar[k] : S;
+
+                    for (size_t j{}; j < num_strikes; ++j) {
+                        const T K = gbm.strikes[j];
+                        T call = std::max(S - K, T{});
+                        T put = std::max(K - S, T{});
+                        T control = S;
+
+                        if (antithetic) {
+                            // Mirror path -Z; the pair average is the sample
+                            call = (call + std::max(S_bar - K, T{})) / static_cast<T>(2);
+                            put = (put + std::max(K - S_bar, T{})) / static_cast<T>(2);
+                            control = (S + S_bar) / static_cast<T>(2);
+                        }
+
+                        row[j].push(call, put, control, control_variate);
+                    }
+                }
+            }
+        }
+
+        // Terminal prices of a block, payoffs and their pathwise derivatives
+        // (undiscounted) - PRIVATE helper (count <= block_size)
+        void accumulate_greeks(
+            GreekStatistics& acc,
+            size_t first,
+            size_t count,
+            size_t replicate,
+            const GbmGrid& gbm,
+            T sigma,
+            T time
+        ) const {
+            const bool antithetic = config_.antithetic;
+            const bool control_variate = config_.control_variate;
+            const T K = gbm.strikes.front();
+            const T drift = gbm.drift.front();
+            const T vol = gbm.vol.front();  // σ √T
+            const T sqrt_time = std::sqrt(time);
+            const T sigma_time = sigma * time;
+            const T rho_weight = K * time;
+
+            std::array<T, block_size> Z, ST, ST_bar;
+
+            // Step 1 - Terminal prices S(T) / S0 of the path and its mirror
+            fill_normals(std::span<T>(Z.data(), count), first, replicate, 0);
+            for (size_t k{}; k < count; ++k) {
+                ST[k] = drift + vol * Z[k];
+                ST_bar[k] = drift - vol * Z[k];
+            }
+            math::vexp(std::span<const T>(ST.data(), count), std::span<T>(ST.data(), count));
+            if (antithetic) {
+                math::vexp(std::span<const T>(ST_bar.data(), count), std::span<T>(ST_bar.data(), count));
+            }
+
+            // Step 2 - Payoff, ∂/∂S0, ∂/∂σ and ∂/∂r (with the discount) per path
+            // dS(T)/dσ = S(T) (√T Z - σT)
+            const auto path = [&](T ratio, T z, std::array<T, 4>& call, std::array<T, 4>& put) {
+                const T S = gbm.S0 * ratio;
+                const T in_call = S > K ? static_cast<T>(1) : T{};
+                const T in_put = S < K ? static_cast<T>(1) : T{};
+                const T dS_dsigma = S * (sqrt_time * z - sigma_time);
+                call = { std::max(S - K, T{}), in_call * ratio, in_call * dS_dsigma, in_call * rho_weight };
+                put = { std::max(K - S, T{}), -in_put * ratio, -in_put * dS_dsigma, -in_put * rho_weight };
+            };
+
+            // Step 3 - Accumulate; the mirror path -Z is averaged in
+            std::array<T, 4> call, put, call_bar, put_bar;
+            for (size_t k{}; k < count; ++k) {
+                path(ST[k], Z[k], call, put);
+                T control = gbm.S0 * ST[k];
+                if (antithetic) {
+                    path(ST_bar[k], -Z[k], call_bar, put_bar);
+                    for (size_t g{}; g < 4; ++g) {
+                        call[g] = (call[g] + call_bar[g]) / static_cast<T>(2);
+                        put[g] = (put[g] + put_bar[g]) / static_cast<T>(2);
+                    }
+                    control = (control + gbm.S0 * ST_bar[k]) / static_cast<T>(2);
+                }
+                for (size_t g{}; g < 4; ++g) {
+                    acc.values[g].push(call[g], put[g], control, control_variate);
+                }
+            }
+        }
+
+        // Terminal prices of a block, then price/delta/gamma estimators of every
+        // position and of the book (undiscounted) - PRIVATE helper (count <= block_size)
+        template<typename Payoff>
+        void accumulate_book_greeks(
+            BookStatistics& acc,
+            size_t first,
+            size_t count,
+            size_t replicate,
+            const GbmGrid& gbm,
+            std::span<const Payoff> book,
+            GreekEstimator estimator
+        ) const {
+            const bool antithetic = config_.antithetic;
+            const bool mixed = estimator == GreekEstimator::Mixed;
+            const T S0 = gbm.S0;
+            const T drift = gbm.drift.front();
+            const T vol = gbm.vol.front();  // σ √T
+            const T inv_vol = static_cast<T>(1) / vol;
+
+            std::array<T, block_size> Z, ST, ST_bar;
+
+            // Step 1 - Terminal prices S(T) / S0 of the path and its mirror
+            fill_normals(std::span<T>(Z.data(), count), first, replicate, 0);
+            for (size_t k{}; k < count; ++k) {
+                ST[k] = drift + vol * Z[k];
+                ST_bar[k] = drift - vol * Z[k];
+            }
+            math::vexp(std::span<const T>(ST.data(), count), std::span<T>(ST.data(), count));
+            if (antithetic) {
+                math::vexp(std::span<const T>(ST_bar.data(), count), std::span<T>(ST_bar.data(), count));
+            }
+
+            // Step 2 - Estimators of one path (price, delta, gamma per position, then the total)
+            // (per-thread scratch: no allocation after a thread's first block)
+            const size_t n = book.size();
+            thread_local std::vector<T> sample;
+            sample.resize(3 * (n + 1));
+            const auto path = [&](T ratio, T z, T weight) {
+                const T S = S0 * ratio;
+                const T zeta = z * inv_vol;
+                const T score_delta = zeta / S0;
+                const T score_gamma = (zeta * zeta - inv_vol * inv_vol - zeta) / (S0 * S0);
+
+                T* total = sample.data() + 3 * n;
+                for (size_t j{}; j < n; ++j) {
+                    const T f = book[j](S);
+                    T delta = f * score_delta;
+                    T gamma = f * score_gamma;
+                    if (mixed) {
+                        const T jump = f - book[j].smooth(S);
+                        const T slope = book[j].smooth_derivative(S);
+                        delta = slope * ratio + jump * score_delta;
+                        gamma = slope * ratio / S0 * (zeta - static_cast<T>(1)) + jump * score_gamma;
+                    }
+                    sample[3 * j] += weight * f;
+                    sample[3 * j + 1] += weight * delta;
+                    sample[3 * j + 2] += weight * gamma;
+                    total[0] += weight * f;
+                    total[1] += weight * delta;
+                    total[2] += weight * gamma;
+                }
+            };
+
+            // Step 3 - Accumulate; the mirror path -Z is averaged in
+            const T weight = antithetic ? static_cast<T>(0.5) : static_cast<T>(1);
+            for (size_t k{}; k < count; ++k) {
+                std::fill(sample.begin(), sample.end(), T{});
+                path(ST[k], Z[k], weight);
+                if (antithetic) {
+                    path(ST_bar[k], -Z[k], weight);
+                }
+                for (size_t i{}; i < sample.size(); ++i) {
+                    acc.values[i].push(sample[i]);
+                }
+            }
+        }
+
+        // Adjoint run over a block: setup once, then record / sweep / rewind
+        // every path; one gradient sample per block, weighted by count - PRIVATE helper (count <= block_size)
+        template<typename Setup, typename Payoff>
+        void accumulate_adjoint(
+            AdjointStatistics& acc,
+            size_t first,
+            size_t count,
+            size_t replicate,
+            std::span<const T> inputs,
+            size_t num_normals,
+            Setup& setup,
+            Payoff& payoff
+        ) const {
+            // One tape and scratch per thread, reused: nothing grows after the first block
+            thread_local math::Tape<T> tape;
+            thread_local std::vector<math::Var<T>> x;
+            thread_local std::vector<T> Z, z;
+            const typename math::Tape<T>::Scope scope(tape);
+            tape.clear();
+
+            // Step 1 - Inputs and shared setup, then the checkpoint
+            x.clear();
+            for (const T value : inputs) {
+                x.push_back(tape.variable(value));
+            }
+            const auto state = setup(std::span<const math::Var<T>>(x));
+            const size_t checkpoint = tape.mark();
+
+            // Step 2 - Normals of the block, dimension-major
+            Z.resize(num_normals * count);
+            for (size_t d{}; d < num_normals; ++d) {
+                fill_normals(std::span<T>(Z.data() + d * count, count), first, replicate, static_cast<std::uint32_t>(d));
+            }
+
+            // Step 3 - Per path: record, sweep back to the checkpoint, rewind
+            const T weight = static_cast<T>(1) / static_cast<T>(count);
+            z.resize(num_normals);
+            for (size_t k{}; k < count; ++k) {
+                for (size_t d{}; d < num_normals; ++d) {
+                    z[d] = Z[d * count + k];
+                }
+                math::Var<T> value = payoff(state, std::span<const T>(z));
+                if (config_.antithetic) {
+                    // Mirror path -Z; the pair average is the sample
+                    for (T& v : z) v = -v;
+                    value = (value + payoff(state, std::span<const T>(z))) * static_cast<T>(0.5);
+                }
+
+                acc.price.push(value.value);
+                tape.seed(value, weight);
+                tape.propagate(checkpoint);
+                tape.rewind(checkpoint);
+            }
+
+            // Step 4 - Sweep the setup: the block's mean gradient, over `count` paths
+            tape.propagate();
+            for (size_t i{}; i < x.size(); ++i) {
+                acc.sensitivities[i].push(tape.adjoint(x[i]), count);
+            }
+        }
+
+        // Evolve a block of samples through every fixing, average, pay off and
+        // accumulate - PRIVATE helper (count <= block_size)
+        void accumulate_asian(
+            AsianStatistics& acc,
+            size_t first,
+            size_t count,
+            size_t replicate,
+            const GbmGrid& gbm,
+            T K
+        ) const {
+            const bool antithetic = config_.antithetic;
+            const T inv_n = static_cast<T>(1) / static_cast<T>(gbm.drift.size());
+
+            std::array<T, block_size> Z;
+            std::array<T, block_size> S;
+            std::array<T, block_size> X{};            // log-return to the current fixing
+            std::array<T, block_size> X_bar{};        // same for the mirror path -Z
+            std::array<T, block_size> sum_S{};       // Σ S(t_i) / S0
+            std::array<T, block_size> sum_S_bar{};
+            std::array<T, block_size> sum_X{};       // Σ ln(S(t_i) / S0)
+            std::array<T, block_size> sum_X_bar{};
+
+            for (size_t m{}; m < gbm.drift.size(); ++m) {
+                // Step 1 - Increments to fixing m from their own normal dimension
+                fill_normals(std::span<T>(Z.data(), count), first, replicate, static_cast<std::uint32_t>(m));
+                for (size_t k{}; k < count; ++k) {
+                    X[k] += gbm.drift[m] + gbm.vol[m] * Z[k];
+                    X_bar[k] += gbm.drift[m] - gbm.vol[m] * Z[k];
+                    sum_X[k] += X[k];
+                    sum_X_bar[k] += X_bar[k];
+                }
+
+                // Step 2 - Running arithmetic sums, one SIMD exp pass per block
+                math::vexp(std::span<const T>(X.data(), count), std::span<T>(S.data(), count));
+                for (size_t k{}; k < count; ++k) sum_S[k] += S[k];
+
+                if (antithetic) {
+                    math::vexp(std::span<const T>(X_bar.data(), count), std::span<T>(S.data(), count));
+                    for (size_t k{}; k < count; ++k) sum_S_bar[k] += S[k];
+                }
+            }
+
+            // Step 3 - Geometric averages G / S0 = exp(mean log-return), in place
+            for (size_t k{}; k < count; ++k) {
+                sum_X[k] *= inv_n;
+                sum_X_bar[k] *= inv_n;
+            }
+            math::vexp(std::span<const T>(sum_X.data(), count), std::span<T>(sum_X.data(), count));
+            if (antithetic) {
+                math::vexp(std::span<const T>(sum_X_bar.data(), count), std::span<T>(sum_X_bar.data(), count));
+            }
+
+            // Step 4 - Arithmetic payoffs with their geometric controls
+            for (size_t k{}; k < count; ++k) {
+                const T A = gbm.S0 * sum_S[k] * inv_n;
+                const T G = gbm.S0 * sum_X[k];
+                T call = std::max(A - K, T{});
+                T put = std::max(K - A, T{});
+                T geometric_call = std::max(G - K, T{});
+                T geometric_put = std::max(K - G, T{});
+
+                if (antithetic) {
+                    // Mirror path -Z; the pair average is the sample
+                    const T A_bar = gbm.S0 * sum_S_bar[k] * inv_n;
+                    const T G_bar = gbm.S0 * sum_X_bar[k];
+                    call = (call + std::max(A_bar - K, T{})) / static_cast<T>(2);
+                    put = (put + std::max(K - A_bar, T{})) / static_cast<T>(2);
+                    geometric_call = (geometric_call + std::max(G_bar - K, T{})) / static_cast<T>(2);
+                    geometric_put = (geometric_put + std::max(K - G_bar, T{})) / static_cast<T>(2);
+                }
+
+                acc.call.push(call, { geometric_call });
+                acc.put.push(put, { geometric_put });
+            }
+        }
+
+        // Evolve a block of samples on the monitoring grid, track the survival
+        // probability, pay off and accumulate - PRIVATE helper (count <= block_size)
+        void accumulate_barrier(
+            CallPutStatistics& acc,
+            size_t first,
+            size_t count,
+            size_t replicate,
+            const GbmGrid& gbm,
+            const BarrierSpec& barrier
+        ) const {
+            const bool antithetic = config_.antithetic;
+            const bool control_variate = config_.control_variate;
+            const T a0 = barrier.log_spot_to_barrier;
+            const auto alive = [down = barrier.down](T a) { return down ? a > T{} : a < T{}; };
+
+            std::array<T, block_size> Z;
+            std::array<T, block_size> X{};      // log-return to the current step
+            std::array<T, block_size> X_bar{};  // same for the mirror path -Z
+            std::array<T, block_size> cross;    // bridge exponents, then crossing probabilities
+            std::array<T, block_size> cross_bar;
+            std::array<T, block_size> survival;
+            std::array<T, block_size> survival_bar;
+
+            // A barrier already touched at t = 0 has knocked
+            std::fill_n(survival.begin(), count, alive(a0) ? static_cast<T>(1) : T{});
+            std::fill_n(survival_bar.begin(), count, alive(a0) ? static_cast<T>(1) : T{});
+
+            for (size_t m{}; m < gbm.drift.size(); ++m) {
+                const T inv_bridge_var = static_cast<T>(1) / (gbm.vol[m] * gbm.vol[m]);  // 1 / (σ² Δt)
+
+                // Step 1 - Increments from their own normal dimension, and the bridge
+                // exponents -2 a_i a_i+1 / (σ² Δt), clamped at 0 (sign change = crossed)
+                fill_normals(std::span<T>(Z.data(), count), first, replicate, static_cast<std::uint32_t>(m));
+                for (size_t k{}; k < count; ++k) {
+                    const T a_prev = a0 + X[k];
+                    const T a_prev_bar = a0 + X_bar[k];
+                    X[k] += gbm.drift[m] + gbm.vol[m] * Z[k];
+                    X_bar[k] += gbm.drift[m] - gbm.vol[m] * Z[k];
+                    cross[k] = std::min(static_cast<T>(-2) * a_prev * (a0 + X[k]) * inv_bridge_var, T{});
+                    cross_bar[k] = std::min(static_cast<T>(-2) * a_prev_bar * (a0 + X_bar[k]) * inv_bridge_var, T{});
+                }
+
+                // Step 2 - Crossing probabilities, one SIMD exp pass per block
+                if (barrier.bridge_correction) {
+                    math::vexp(std::span<const T>(cross.data(), count), std::span<T>(cross.data(), count));
+                    if (antithetic) {
+                        math::vexp(std::span<const T>(cross_bar.data(), count), std::span<T>(cross_bar.data(), count));
+                    }
+                }
+
+                // Step 3 - Survive the step: end on the live side, not crossed in between
+                for (size_t k{}; k < count; ++k) {
+                    const T stay = barrier.bridge_correction ? static_cast<T>(1) - cross[k] : static_cast<T>(1);
+                    const T stay_bar = barrier.bridge_correction ? static_cast<T>(1) - cross_bar[k] : static_cast<T>(1);
+                    survival[k] *= alive(a0 + X[k]) ? stay : T{};
+                    survival_bar[k] *= alive(a0 + X_bar[k]) ? stay_bar : T{};
+                }
+            }
+
+            // Step 4 - Terminal prices S(T) = S0 * exp(X)
+            math::vexp(std::span<const T>(X.data(), count), std::span<T>(X.data(), count));
+            if (antithetic) {
+                math::vexp(std::span<const T>(X_bar.data(), count), std::span<T>(X_bar.data(), count));
+            }
+
+            // Step 5 - Vanilla payoffs weighted by the probability the option is live
+            const auto live = [knock_out = barrier.knock_out](T survived) {
+                return knock_out ? survived : static_cast<T>(1) - survived;
+            };
+            for (size_t k{}; k < count; ++k) {
+                const T S = gbm.S0 * X[k];
+                T call = std::max(S - barrier.K, T{}) * live(survival[k]);
+                T put = std::max(barrier.K - S, T{}) * live(survival[k]);
+                T control = S;
+
+                if (antithetic) {
+                    // Mirror path -Z; the pair average is the sample
+                    const T S_bar = gbm.S0 * X_bar[k];
+                    call = (call + std::max(S_bar - barrier.K, T{}) * live(survival_bar[k])) / static_cast<T>(2);
+                    put = (put + std::max(barrier.K - S_bar, T{}) * live(survival_bar[k])) / static_cast<T>(2);
+                    control = (S + S_bar) / static_cast<T>(2);
+                }
+
+                acc.push(call, put, control, control_variate);
+            }
+        }
+
+        // QE-evolve a block of samples to maturity, pay off and accumulate
+        // - PRIVATE helper (count <= block_size)
+        void accumulate_heston(
+            CallPutStatistics& acc,
+            size_t first,
+            size_t count,
+            size_t replicate,
+            const HestonPathEngine<T>& engine,
+            T K
+        ) const {
+            const bool antithetic = config_.antithetic;
+            const bool control_variate = config_.control_variate;
+
+            std::array<T, block_size> Z_v, Z_S;
+            std::array<T, block_size> X{}, V, X_bar{}, V_bar;
+            std::fill_n(V.begin(), count, engine.initial_variance());
+            std::fill_n(V_bar.begin(), count, engine.initial_variance());
+
+            for (size_t s{}; s < engine.num_steps(); ++s) {
+                // Step 1 - Variance and price normals of this step
+                fill_normals(std::span<T>(Z_v.data(), count), first, replicate, static_cast<std::uint32_t>(2 * s));
+                fill_normals(std::span<T>(Z_S.data(), count), first, replicate, static_cast<std::uint32_t>(2 * s + 1));
+
+                // Step 2 - QE step; the mirror path is driven by -Z
+                engine.advance(s, std::span<T>(X.data(), count), std::span<T>(V.data(), count),
+                    std::span<const T>(Z_v.data(), count), std::span<const T>(Z_S.data(), count));
+                if (antithetic) {
+                    for (size_t k{}; k < count; ++k) {
+                        Z_v[k] = -Z_v[k];
+                        Z_S[k] = -Z_S[k];
+                    }
+                    engine.advance(s, std::span<T>(X_bar.data(), count), std::span<T>(V_bar.data(), count),
+                        std::span<const T>(Z_v.data(), count), std::span<const T>(Z_S.data(), count));
+                }
+            }
+
+            // Step 3 - Terminal prices S(T) = S0 * exp(X)
+            math::vexp(std::span<const T>(X.data(), count), std::span<T>(X.data(), count));
+            if (antithetic) {
+                math::vexp(std::span<const T>(X_bar.data(), count), std::span<T>(X_bar.data(), count));
+            }
+
+            // Step 4 - Payoffs and accumulation
+            const T S0 = engine.spot_price();
+            for (size_t k{}; k < count; ++k) {
+                const T S = S0 * X[k];
+                T call = std::max(S - K, T{});
+                T put = std::max(K - S, T{});
+                T control = S;
+
+                if (antithetic) {
+                    const T S_bar = S0 * X_bar[k];
+                    call = (call + std::max(S_bar - K, T{})) / static_cast<T>(2);
+                    put = (put + std::max(K - S_bar, T{})) / static_cast<T>(2);
+                    control = (S + S_bar) / static_cast<T>(2);
+                }
+
+                acc.push(call, put, control, control_variate);
+            }
+        }
+
+        // Jump-diffusion terminal prices of a block, pay off and accumulate
+        // - PRIVATE helper (count <= block_size)
+        template<typename Jumps>
+        void accumulate_jump_diffusion(
+            CallPutStatistics& acc,
+            size_t first,
+            size_t count,
+            size_t replicate,
+            const JumpDiffusionPathEngine<T, Jumps>& engine,
+            T K
+        ) const {
+            const bool antithetic = config_.antithetic;
+            const bool control_variate = config_.control_variate;
+
+            std::array<T, block_size> Z, J;
+            std::array<T, block_size> X{}, X_bar{};
+
+            // Step 1 - Diffusion normals and exact jump totals to maturity
+            fill_normals(std::span<T>(Z.data(), count), first, replicate, 0);
+            engine.jump_sums(std::span<T>(J.data(), count), first, count);
+
+            // Step 2 - Log-returns; the mirror path negates Z and keeps the jumps
+            engine.advance(0, std::span<T>(X.data(), count), std::span<const T>(Z.data(), count), std::span<const T>(J.data(), count));
+            math::vexp(std::span<const T>(X.data(), count), std::span<T>(X.data(), count));
+            if (antithetic) {
+                for (size_t k{}; k < count; ++k) Z[k] = -Z[k];
+                engine.advance(0, std::span<T>(X_bar.data(), count), std::span<const T>(Z.data(), count), std::span<const T>(J.data(), count));
+                math::vexp(std::span<const T>(X_bar.data(), count), std::span<T>(X_bar.data(), count));
+            }
+
+            // Step 3 - Payoffs and accumulation
+            const T S0 = engine.spot_price();
+            for (size_t k{}; k < count; ++k) {
+                const T S = S0 * X[k];
+                T call = std::max(S - K, T{});
+                T put = std::max(K - S, T{});
+                T control = S;
+
+                if (antithetic) {
+                    const T S_bar = S0 * X_bar[k];
+                    call = (call + std::max(S_bar - K, T{})) / static_cast<T>(2);
+                    put = (put + std::max(K - S_bar, T{})) / static_cast<T>(2);
+                    control = (S + S_bar) / static_cast<T>(2);
+                }
+
+                acc.push(call, put, control, control_variate);
+            }
+        }
+
+        // Local-vol terminal prices of a block, pay off and accumulate
+        // - PRIVATE helper (count <= block_size)
+        void accumulate_local_vol(
+            CallPutStatistics& acc,
+            size_t first,
+            size_t count,
+            size_t replicate,
+            const LocalVolPathEngine<T>& engine,
+            T K
+        ) const {
+            const bool antithetic = config_.antithetic;
+            const bool control_variate = config_.control_variate;
+
+            std::array<T, block_size> Z, sigma;
+            std::array<T, block_size> X{}, X_bar{};
+
+            for (size_t e{}; e < engine.num_euler_steps(); ++e) {
+                // Step 1 - Normals of this Euler step
+                fill_normals(std::span<T>(Z.data(), count), first, replicate, static_cast<std::uint32_t>(e));
+
+                // Step 2 - Log-Euler step; the mirror path is driven by -Z
+                engine.advance(e, std::span<T>(X.data(), count), std::span<const T>(Z.data(), count), std::span<T>(sigma.data(), count));
+                if (antithetic) {
+                    for (size_t k{}; k < count; ++k) Z[k] = -Z[k];
+                    engine.advance(e, std::span<T>(X_bar.data(), count), std::span<const T>(Z.data(), count), std::span<T>(sigma.data(), count));
+                }
+            }
+
+            // Step 3 - Terminal prices S(T) = S0 * exp(X)
+            math::vexp(std::span<const T>(X.data(), count), std::span<T>(X.data(), count));
+            if (antithetic) {
+                math::vexp(std::span<const T>(X_bar.data(), count), std::span<T>(X_bar.data(), count));
+            }
+
+            // Step 4 - Payoffs and accumulation
+            const T S0 = engine.spot_price();
+            for (size_t k{}; k < count; ++k) {
+                const T S = S0 * X[k];
+                T call = std::max(S - K, T{});
+                T put = std::max(K - S, T{});
+                T control = S;
+
+                if (antithetic) {
+                    const T S_bar = S0 * X_bar[k];
+                    call = (call + std::max(S_bar - K, T{})) / static_cast<T>(2);
+                    put = (put + std::max(K - S_bar, T{})) / static_cast<T>(2);
+                    control = (S + S_bar) / static_cast<T>(2);
+                }
+
+                acc.push(call, put, control, control_variate);
+            }
+        }
+
+        // Fused kernel over samples [begin, end) of every replicate:
+        // generate -> evolve -> payoff -> accumulate per chunk, then merge into
+        // `replicates`. Nothing of size N is stored: chunks run in groups of a
+        // fixed size, so at most max_partials accumulators (copies of `empty`,
+        // filled by kernel(acc, first, count, replicate)) exist at any time.
+        template<typename Statistics, typename Kernel>
+        void simulate(
+            std::span<Statistics> replicates,
+            size_t begin,
+            size_t end,
+            const Statistics& empty,
+            Kernel&& kernel
+        ) const {
+            const size_t chunks = (end - begin + chunk_size - 1) / chunk_size;
+            const size_t group = std::max<size_t>(1, max_partials / replicates.size());
+            std::vector<Statistics> partials;
+
+            for (size_t first_chunk{}; first_chunk < chunks; first_chunk += group) {
+                const size_t n = std::min(group, chunks - first_chunk);
+                partials.assign(replicates.size() * n, empty);
+
+                for_each_chunk(partials, [&](Statistics& acc, size_t item) {
+                    const size_t replicate = item / n;
+                    const size_t chunk_begin = begin + (first_chunk + item % n) * chunk_size;
+                    const size_t chunk_end = std::min(chunk_begin + chunk_size, end);
+
+                    for (size_t i = chunk_begin; i < chunk_end; i += block_size) {
+                        kernel(acc, i, std::min(block_size, chunk_end - i), replicate);
+                    }
+                });
+
+                // Combine the group's chunks in a fixed tree, then fold the groups
+                // in index order: bit-identical for any thread count
+                for (size_t s{}; s < replicates.size(); ++s) {
+                    replicates[s].merge(merge_pairwise(std::span(partials).subspan(s * n, n)));
+                }
+            }
+        }
+
+        /**
+         * Fixed or adaptive run shared by every product
+         * simulate_range(replicates, begin, end) adds samples [begin, end) of
+         * every replicate; make(replicates) turns the statistics into a result
+         * with num_paths, stop_reason and max_standard_error(). Adaptive runs
+         * stop once the worst standard error meets the target.
+         */
+        template<typename Statistics, typename SimulateRange, typename MakeResult>
+        auto run(SimulateRange&& simulate_range, MakeResult&& make) const {
+            const size_t R = num_replicates();
+            if (config_.sampling == Sampling::Sobol && R < 2)
+                throw std::invalid_argument("Sobol sampling needs at least 2 randomizations");
+
+            std::vector<Statistics> replicates(R);
+
+            if (!is_adaptive()) {
+                // Samples per replicate; max_paths is a hard cap
+                const size_t M = config_.max_paths > 0 ? std::min(num_samples(), max_samples()) : num_samples();
+                check_sample_range(M);
+                simulate_range(std::span<Statistics>(replicates), 0, M);
+
+                auto result = make(std::span<const Statistics>(replicates));
+                result.num_paths = paths_for(M);
+                return result;
+            }
+
+            // Adaptive: simulate in batches and stop as soon as any criterion is met
+            const auto start = std::chrono::steady_clock::now();
+            const size_t sample_cap = config_.max_paths > 0 ? max_samples() : num_samples();
+            const size_t batch = std::max<size_t>(config_.batch_size / paths_per_sample(), min_batch_samples);
+            check_sample_range(sample_cap);
+
+            for (size_t done{};;) {
+                const size_t next = std::min(done + batch, sample_cap);
+                simulate_range(std::span<Statistics>(replicates), done, next);
+                done = next;
+
+                auto result = make(std::span<const Statistics>(replicates));
+                result.num_paths = paths_for(done);
+
+                if (config_.target_standard_error > 0
+                    && result.max_standard_error() <= config_.target_standard_error) {
+                    result.stop_reason = StopReason::TargetError;
+                }
+                else if (config_.max_wall_time.count() > 0
+                    && std::chrono::steady_clock::now() - start >= config_.max_wall_time) {
+                    result.stop_reason = StopReason::WallTime;
+                }
+                else if (done >= sample_cap) {
+                    result.stop_reason = StopReason::PathBudget;
+                }
+                else {
+                    continue;
+                }
+                return result;
+            }
+        }
+
+        // Price calls and puts of every (maturity, strike) cell from ONE path set
+        // Counter-based engine (Philox or shifted Sobol), sequential or parallel,
+        // with a fixed path count or adaptive stopping
+        GridResult price_grid_chunked(
+            T S0, T r, T sigma,
+            std::span<const T> strikes,
+            std::span<const T> maturities
+        ) const {
+            if (strikes.empty())
+                throw std::invalid_argument("Grid needs at least one strike");
+
+            const GbmGrid gbm = make_gbm(S0, r, sigma, maturities, strikes);
+            const GridStatistics empty{ std::vector<CallPutStatistics>(maturities.size() * strikes.size()) };
+
+            return run<GridStatistics>(
+                [&](std::span<GridStatistics> replicates, size_t begin, size_t end) {
+                    simulate(replicates, begin, end, empty,
+                        [&](GridStatistics& acc, size_t first, size_t count, size_t replicate) {
+                            accumulate_paths(acc, first, count, replicate, gbm);
+                        });
+                },
+                [&](std::span<const GridStatistics> replicates) {
+                    return make_grid_result(replicates, S0, r, maturities, strikes.size());
+                });
+        }
+
+        // Arithmetic Asian call and put with the geometric control variate
+        CallPutResult price_asian_chunked(
+            T S0, T K, T r, T sigma,
+            std::span<const T> fixing_times,
+            const model::GeometricAsianModel<T>& geometric
+        ) const {
+            const GbmGrid gbm = make_gbm(S0, r, sigma, fixing_times, {});
+
+            return run<AsianStatistics>(
+                [&](std::span<AsianStatistics> replicates, size_t begin, size_t end) {
+                    simulate(replicates, begin, end, AsianStatistics{},
+                        [&](AsianStatistics& acc, size_t first, size_t count, size_t replicate) {
+                            accumulate_asian(acc, first, count, replicate, gbm, K);
+                        });
+                },
+                [&](std::span<const AsianStatistics> replicates) {
+                    return make_asian_result(replicates, geometric, r);
+                });
+        }
+
+        // Barrier call and put on an equal-step monitoring grid
+        CallPutResult price_barrier_chunked(
+            const model::BarrierCreateInfo<T>& info,
+            size_t num_steps,
+            bool bridge_correction
+        ) const {
+            const std::vector<T> times = uniform_time_grid(info.time_to_maturity, num_steps);
+            const GbmGrid gbm = make_gbm(info.spot_price, info.risk_free_rate, info.volatility, times, {});
+            const BarrierSpec barrier{
+                .K = info.strike_price,
+                .log_spot_to_barrier = std::log(info.spot_price / info.barrier),
+                .down = info.is_down(),
+                .knock_out = info.is_knock_out(),
+                .bridge_correction = bridge_correction
+            };
+
+            return run<CallPutStatistics>(
+                [&](std::span<CallPutStatistics> replicates, size_t begin, size_t end) {
+                    simulate(replicates, begin, end, CallPutStatistics{},
+                        [&](CallPutStatistics& acc, size_t first, size_t count, size_t replicate) {
+                            accumulate_barrier(acc, first, count, replicate, gbm, barrier);
+                        });
+                },
+                [&](std::span<const CallPutStatistics> replicates) {
+                    return make_result(replicates, info.spot_price, info.risk_free_rate, info.time_to_maturity);
+                });
+        }
+
+        // Multi-asset payoff underlyings of a block - PRIVATE helper
+        // S is asset-major (n x m); the basket doubles as the control variate
+        static void multi_asset_underlying(
+            std::span<const T> S,
+            size_t m,
+            MultiAssetPayoff payoff,
+            std::span<const T> weights,
+            std::span<T> underlying,
+            std::span<T> basket
+        ) noexcept {
+            std::fill_n(basket.begin(), m, T{});
+            for (size_t i{}; i < weights.size(); ++i) {
+                const T w_i = weights[i];
+                for (size_t p{}; p < m; ++p) basket[p] += w_i * S[i * m + p];
+            }
+
+            if (payoff == MultiAssetPayoff::Basket) {
+                std::copy_n(basket.begin(), m, underlying.begin());
+                return;
+            }
+
+            // Running max/min across assets, one unit-stride row at a time
+            const bool best = payoff == MultiAssetPayoff::BestOf;
+            std::copy_n(S.begin(), m, underlying.begin());
+            for (size_t i = 1; i < weights.size(); ++i) {
+                for (size_t p{}; p < m; ++p) {
+                    const T s = S[i * m + p];
+                    underlying[p] = best ? std::max(underlying[p], s) : std::min(underlying[p], s);
+                }
+            }
+        }
+
+        // Correlated terminal prices of a block, payoffs and accumulation -
+        // PRIVATE helper (count <= block_size)
+        void accumulate_multi_asset(
+            CallPutStatistics& acc,
+            size_t first,
+            size_t count,
+            size_t replicate,
+            const CorrelatedGbm<T>& model,
+            MultiAssetPayoff payoff,
+            T K,
+            std::span<const T> weights
+        ) const {
+            const size_t k = model.num_factors();
+            const bool antithetic = config_.antithetic;
+            const bool control_variate = config_.control_variate;
+
+            // Per-thread scratch sized by the asset and factor counts: allocated
+            // once per thread, not per block
+            thread_local std::vector<T> Z, S;
+            Z.resize(k * block_size);
+            S.resize(model.num_assets() * block_size);
+            std::array<T, block_size> underlying, basket, underlying_bar, basket_bar;
+
+            // Step 1 - Independent normals, factor-major
+            for (size_t j{}; j < k; ++j) {
+                fill_normals(std::span<T>(Z.data() + j * count, count), first, replicate, static_cast<std::uint32_t>(j));
+            }
+
+            // Step 2 - Correlated terminal prices and payoff underlyings
+            model.terminal(std::span<const T>(Z.data(), k * count), S, count);
+            multi_asset_underlying(S, count, payoff, weights, underlying, basket);
+            if (antithetic) {
+                model.terminal(std::span<const T>(Z.data(), k * count), S, count, true);
+                multi_asset_underlying(S, count, payoff, weights, underlying_bar, basket_bar);
+            }
+
+            // Step 3 - Payoffs and accumulation
+            for (size_t p{}; p < count; ++p) {
+                T call = std::max(underlying[p] - K, T{});
+                T put = std::max(K - underlying[p], T{});
+                T control = basket[p];
+
+                if (antithetic) {
+                    call = (call + std::max(underlying_bar[p] - K, T{})) / static_cast<T>(2);
+                    put = (put + std::max(K - underlying_bar[p], T{})) / static_cast<T>(2);
+                    control = (control + basket_bar[p]) / static_cast<T>(2);
+                }
+
+                acc.push(call, put, control, control_variate);
+            }
+        }
+
+        // Multi-asset call and put through the shared fused kernel
+        CallPutResult price_multi_asset_chunked(
+            const MultiAssetCreateInfo<T>& info,
+            const CorrelatedGbm<T>& model,
+            MultiAssetPayoff payoff,
+            T K,
+            std::span<const T> weights
+        ) const {
+            T basket_spot{};
+            for (size_t i{}; i < model.num_assets(); ++i) basket_spot += weights[i] * info.spot_prices[i];
+
+            return run<CallPutStatistics>(
+                [&](std::span<CallPutStatistics> replicates, size_t begin, size_t end) {
+                    simulate(replicates, begin, end, CallPutStatistics{},
+                        [&](CallPutStatistics& acc, size_t first, size_t count, size_t replicate) {
+                            accumulate_multi_asset(acc, first, count, replicate, model, payoff, K, weights);
+                        });
+                },
+                [&](std::span<const CallPutStatistics> replicates) {
+                    return make_result(replicates, basket_spot, info.risk_free_rate, info.time_to_maturity);
+                });
+        }
+
+        // Per-chunk accumulators of one backward step: the regression for the
+        // previous date, and at t = 0 the discounted cash flows
+        struct LsmStatistics {
+            math::NormalEquations<T> regression;
+            RunningStatistics<T> value;
+
+            void merge(const LsmStatistics& other) {
+                regression.merge(other.regression);
+                value.merge(other.value);
+            }
+        };
+
+        // Exercise rule fitted by the backward pass
+        struct ExerciseRule {
+            T K;
+            T phi;                   // +1 call, -1 put
+            size_t size;             // basis functions per date
+            std::vector<T> beta;     // continuation coefficients, date-major
+            std::vector<bool> fitted;  // false: regression failed, hold at that date
+        };
+
+        // Moneyness and intrinsic value of a block of prices - PRIVATE helper
+        static void intrinsic(std::span<const T> S, const ExerciseRule& rule, std::span<T> x, std::span<T> payoff) noexcept {
+            for (size_t i{}; i < S.size(); ++i) {
+                x[i] = S[i] / rule.K;
+                payoff[i] = std::max(rule.phi * (S[i] - rule.K), T{});
+            }
+        }
+
+        // Regressed continuation value at date s for a block - PRIVATE helper
+        template<typename Basis>
+        static void continuation(
+            const Basis& basis,
+            const ExerciseRule& rule,
+            size_t s,
+            std::span<const T> x,
+            std::span<T> tile,
+            std::span<T> value
+        ) {
+            const size_t m = x.size();
+            basis.evaluate(x, tile.first(rule.size * m));
+            std::fill_n(value.begin(), m, T{});
+            for (size_t j{}; j < rule.size; ++j) {
+                const T b = rule.beta[s * rule.size + j];
+                for (size_t i{}; i < m; ++i) {
+                    value[i] += b * tile[j * m + i];
+                }
+            }
+        }
+
+        // Least-squares Monte Carlo: stored training paths, backward regression,
+        // then the fitted rule on independent paths
+        template<typename Basis>
+        AmericanResult price_american_lsm(const AmericanCreateInfo<T>& info, const Basis& basis, size_t pricing_paths) const {
+            const size_t N = config_.num_simulations;
+            const size_t n = info.exercise_times.size();
+            const size_t p = basis.size();
+            if (N == 0)
+                throw std::invalid_argument("Least-squares Monte Carlo needs at least one training path");
+            if (p == 0)
+                throw std::invalid_argument("Regression basis needs at least one function");
+
+            const GbmPathEngine<T> engine = make_path_engine(
+                info.spot_price, info.risk_free_rate, info.volatility, info.exercise_times);
+
+            ExerciseRule rule{
+                .K = info.strike_price,
+                .phi = info.type == OptionType::Call ? static_cast<T>(1) : static_cast<T>(-1),
+                .size = p,
+                .beta = std::vector<T>(n * p),
+                .fitted = std::vector<bool>(n)
+            };
+
+            // One-date discount factors e^(-r (t_s - t_s-1)) and to t = 0 e^(-r t_s)
+            std::vector<T> step_discount(n);
+            std::vector<T> discount(n);
+            for (size_t s{}; s < n; ++s) {
+                const T t_prev = s == 0 ? T{} : info.exercise_times[s - 1];
+                step_discount[s] = std::exp(-info.risk_free_rate * (info.exercise_times[s] - t_prev));
+                discount[s] = std::exp(-info.risk_free_rate * info.exercise_times[s]);
+            }
+
+            // Step 1 - Forward pass: training paths chunk by chunk, time-major within a chunk
+            const size_t chunks = (N + chunk_size - 1) / chunk_size;
+            const LsmStatistics empty{ .regression = math::NormalEquations<T>(p), .value = {} };
+            std::vector<LsmStatistics> partials(chunks, empty);
+            std::vector<T> paths(N * n);
+            std::vector<T> V(N);  // cash flow of each path, discounted to the current date
+
+            for_each_chunk(partials, [&](LsmStatistics&, size_t c) {
+                const size_t first = c * chunk_size;
+                const size_t count = std::min(chunk_size, N - first);
+                engine.generate(std::span<T>(paths).subspan(first * n, count * n), first, count);
+            });
+
+            // Step 2 - Backward pass: exercise at t_s with the rule fitted so far,
+            // discount to t_s-1, and accumulate the regression for t_s-1
+            RunningStatistics<T> in_sample;
+            for (size_t s = n; s-- > 0;) {
+                std::fill(partials.begin(), partials.end(), empty);
+
+                for_each_chunk(partials, [&](LsmStatistics& acc, size_t c) {
+                    const size_t first = c * chunk_size;
+                    const size_t count = std::min(chunk_size, N - first);
+                    const std::span<const T> chunk(paths.data() + first * n, count * n);
+
+                    std::array<T, block_size> x, payoff, hold, y;
+                    std::vector<T> tile(p * block_size);
+
+                    for (size_t b{}; b < count; b += block_size) {
+                        const size_t m = std::min(block_size, count - b);
+                        const std::span<T> v(V.data() + first + b, m);
+
+                        // Exercise where the intrinsic value beats the regressed continuation
+                        intrinsic(chunk.subspan(s * count + b, m), rule, x, payoff);
+                        if (s == n - 1) {
+                            std::copy_n(payoff.begin(), m, v.begin());
+                        }
+                        else if (rule.fitted[s]) {
+                            continuation(basis, rule, s, std::span<const T>(x.data(), m), tile, hold);
+                            for (size_t i{}; i < m; ++i) {
+                                v[i] = payoff[i] > T{} && payoff[i] > hold[i] ? payoff[i] : v[i];
+                            }
+                        }
+                        for (size_t i{}; i < m; ++i) {
+                            v[i] *= step_discount[s];
+                        }
+
+                        if (s == 0) {
+                            for (size_t i{}; i < m; ++i) acc.value.push(v[i]);
+                            continue;
+                        }
+
+                        // Regress on the in-the-money paths of t_s-1 only
+                        intrinsic(chunk.subspan((s - 1) * count + b, m), rule, x, payoff);
+                        size_t k{};
+                        for (size_t i{}; i < m; ++i) {
+                            x[k] = x[i];
+                            y[k] = v[i];
+                            k += payoff[i] > T{} ? 1 : 0;
+                        }
+                        basis.evaluate(std::span<const T>(x.data(), k), std::span<T>(tile).first(p * k));
+                        acc.regression.push_tile(std::span<const T>(tile.data(), p * k), std::span<const T>(y.data(), k));
+                    }
+                });
+
+                // Fixed merge tree: the fit does not depend on the thread count
+                const LsmStatistics total = merge_pairwise(std::span(partials));
+                if (s > 0) {
+                    rule.fitted[s - 1] = total.regression.solve(std::span(rule.beta).subspan((s - 1) * p, p));
+                }
+                else {
+                    in_sample = total.value;
+                }
+            }
+
+            // Step 3 - Second pass: the fitted rule on paths [N, N + pricing_paths),
+            // independent of the training paths, streamed tile by tile
+            const size_t pricing_chunks = (pricing_paths + chunk_size - 1) / chunk_size;
+            std::vector<RunningStatistics<T>> values(pricing_chunks);
+
+            for_each_chunk(values, [&](RunningStatistics<T>& acc, size_t c) {
+                const size_t first = N + c * chunk_size;
+                const size_t count = std::min(chunk_size, N + pricing_paths - first);
+
+                std::array<T, block_size> x, payoff, hold, value;
+                std::array<bool, block_size> alive;
+                std::vector<T> tile(p * block_size);
+
+                engine.for_each_tile(first, count, [&](PathView<T> view, size_t) {
+                    const size_t m = view.num_paths();
+                    std::fill_n(value.begin(), m, T{});
+                    std::fill_n(alive.begin(), m, true);
+
+                    for (size_t s{}; s < n; ++s) {
+                        intrinsic(view.step(s), rule, x, payoff);
+                        const bool last = s == n - 1;
+                        if (!last && rule.fitted[s]) {
+                            continuation(basis, rule, s, std::span<const T>(x.data(), m), tile, hold);
+                        }
+                        for (size_t i{}; i < m; ++i) {
+                            const bool exercise = alive[i] && payoff[i] > T{}
+                                && (last || (rule.fitted[s] && payoff[i] > hold[i]));
+                            value[i] += exercise ? discount[s] * payoff[i] : T{};
+                            alive[i] = alive[i] && !exercise;
+                        }
+                    }
+                    for (size_t i{}; i < m; ++i) acc.push(value[i]);
+                }, block_size);
+            });
+
+            const RunningStatistics<T> low_biased = merge_pairwise(std::span(values));
+
+            return {
+                .price = compute_statistics(low_biased, static_cast<T>(1)),
+                .in_sample = compute_statistics(in_sample, static_cast<T>(1)),
+                .training_paths = N,
+                .pricing_paths = pricing_paths
+            };
+        }
+
+        // Sample extra[l] more corrections of every level in one sweep of
+        // (level, chunk) items, then merge each level's chunks in order
+        template<typename Sampler>
+        void sample_levels(std::vector<RunningStatistics<T>>& stats, std::span<const size_t> extra, Sampler& sampler) const {
+            struct Item {
+                size_t level;
+                size_t first;
+                size_t count;
+            };
+            std::vector<Item> items;
+            std::vector<size_t> level_begin;
+            for (size_t l{}; l < stats.size(); ++l) {
+                level_begin.push_back(items.size());
+                const size_t begin = stats[l].count();
+                for (size_t first = begin; first < begin + extra[l]; first += chunk_size) {
+                    items.push_back({ l, first, std::min(chunk_size, begin + extra[l] - first) });
+                }
+            }
+            level_begin.push_back(items.size());
+
+            std::vector<RunningStatistics<T>> partials(items.size());
+            for_each_chunk(partials, [&](RunningStatistics<T>& acc, size_t i) {
+                sampler(acc, items[i].level, items[i].first, items[i].count);
+            });
+            for (size_t l{}; l < stats.size(); ++l) {
+                const std::span<RunningStatistics<T>> parts(partials.data() + level_begin[l], level_begin[l + 1] - level_begin[l]);
+                if (!parts.empty()) stats[l].merge(merge_pairwise(parts));
+            }
+        }
+
+        // extra[l] = samples still missing for the optimal N_l
+        static void update_extra_samples(
+            const std::vector<RunningStatistics<T>>& stats,
+            std::span<const T> variances,
+            std::span<const T> costs,
+            T target_rmse,
+            std::vector<size_t>& extra
+        ) {
+            const std::vector<size_t> target = multilevel_samples(variances, costs, target_rmse);
+            for (size_t l{}; l < stats.size(); ++l) {
+                extra[l] = target[l] > stats[l].count() ? target[l] - stats[l].count() : 0;
+            }
+        }
+
+        // Path functional of the built-in MLMC products
+        struct MultilevelPathPayoff {
+            T K;
+            bool call;
+            bool asian;                  // trapezoidal average of S, else barrier on S(T)
+            T log_spot_to_barrier = {};  // ln(S0 / H), barrier only
+            bool down = false;
+            bool knock_out = false;
+        };
+
+        // Level sampler over local-vol engines; engines and normal streams
+        // are built level by level (a level's σ_loc rows scale with its steps)
+        struct LocalVolLevelSampler {
+            const MonteCarloPricer& pricer;
+            const model::LocalVolSurface<T>& surface;
+            T time_to_maturity;
+            size_t base_steps;
+            MultilevelPathPayoff payoff;
+            std::vector<LocalVolPathEngine<T>> engines;
+            std::vector<random::CounterRng<T>> streams;
+
+            LocalVolLevelSampler(const MonteCarloPricer& pricer, const model::LocalVolSurface<T>& surface,
+                T time_to_maturity, size_t base_steps, MultilevelPathPayoff payoff)
+                : pricer(pricer), surface(surface), time_to_maturity(time_to_maturity)
+                , base_steps(base_steps), payoff(payoff)
+            {
+            }
+
+            void prepare(size_t num_levels) {
+                while (engines.size() < num_levels) {
+                    const size_t l = engines.size();
+                    engines.push_back(pricer.make_local_vol_engine(surface, { time_to_maturity },
+                        time_to_maturity / static_cast<T>(base_steps << l)));
+                    // Level l draws from its own Philox key, independent of the others
+                    streams.emplace_back((static_cast<std::uint64_t>(l + 1) << 32) | pricer.config_.seed);
+                }
+            }
+
+            void operator()(RunningStatistics<T>& acc, size_t level, size_t first, size_t count) const {
+                for (size_t b{}; b < count; b += block_size) {
+                    pricer.accumulate_multilevel_local_vol(acc, first + b, std::min(block_size, count - b),
+                        streams[level], engines[level], level == 0 ? nullptr : &engines[level - 1], payoff);
+                }
+            }
+        };
+
+        // Coupled fine/coarse local-vol paths of a block and their payoff
+        // difference - PRIVATE helper (count <= block_size)
+        void accumulate_multilevel_local_vol(
+            RunningStatistics<T>& acc,
+            size_t first,
+            size_t count,
+            const random::CounterRng<T>& stream,
+            const LocalVolPathEngine<T>& fine,
+            const LocalVolPathEngine<T>* coarse,
+            const MultilevelPathPayoff& payoff
+        ) const {
+            const size_t M = fine.num_euler_steps();
+            const T T_mat = fine.times().back();
+            const T dt = T_mat / static_cast<T>(M);
+            const T sqrt_dt = std::sqrt(dt);
+            const T S0 = fine.spot_price();
+            const T a0 = payoff.log_spot_to_barrier;
+            const auto alive = [down = payoff.down](T a) { return down ? a > T{} : a < T{}; };
+
+            std::array<T, block_size> Z, Z_first, Z_c;
+            std::array<T, block_size> X_f{}, X_c{}, prev_f, prev_c, sigma_f, sigma_c;
+            std::array<T, block_size> sum_f{}, sum_c{}, survival_f, survival_c;
+            std::array<T, block_size> mid, work, work_2;
+            std::fill_n(survival_f.begin(), count, alive(a0) ? static_cast<T>(1) : T{});
+            std::fill_n(survival_c.begin(), count, alive(a0) ? static_cast<T>(1) : T{});
+
+            // Bridge survival of a step a -> a' with variance v: 0 if a' is on
+            // the dead side, else 1 - exp(min(-2 a a' / v, 0))
+            const auto survive = [&](std::span<const T> a, std::span<const T> a_next, std::span<const T> vol, std::span<T> survival) {
+                for (size_t k{}; k < count; ++k) {
+                    work[k] = std::min(static_cast<T>(-2) * (a0 + a[k]) * (a0 + a_next[k]) / (vol[k] * vol[k] * dt), T{});
+                }
+                math::vexp(std::span<const T>(work.data(), count), std::span<T>(work.data(), count));
+                for (size_t k{}; k < count; ++k) {
+                    survival[k] *= alive(a0 + a_next[k]) ? static_cast<T>(1) - work[k] : T{};
+                }
+            };
+            // Running sum of S / S0 over the step ends
+            const auto add_spot = [&](std::span<const T> X, std::span<T> sum) {
+                math::vexp(X, std::span<T>(work_2.data(), count));
+                for (size_t k{}; k < count; ++k) sum[k] += work_2[k];
+            };
+
+            for (size_t j{}; j < M; ++j) {
+                // Step 1 - Fine step from the level's own normals
+                stream.fill_normal(std::span<T>(Z.data(), count), first, static_cast<std::uint32_t>(j));
+                std::copy_n(X_f.begin(), count, prev_f.begin());
+                fine.advance(j, std::span<T>(X_f.data(), count), std::span<const T>(Z.data(), count), std::span<T>(sigma_f.data(), count));
+                if (payoff.asian) {
+                    add_spot(std::span<const T>(X_f.data(), count), std::span<T>(sum_f.data(), count));
+                }
+                else {
+                    survive(std::span<const T>(prev_f.data(), count), std::span<const T>(X_f.data(), count),
+                        std::span<const T>(sigma_f.data(), count), std::span<T>(survival_f.data(), count));
+                }
+                if (coarse == nullptr) continue;
+
+                // Step 2 - Every second fine step, one coarse step on the summed normals
+                if (j % 2 == 0) {
+                    std::copy_n(Z.begin(), count, Z_first.begin());
+                    continue;
+                }
+                for (size_t k{}; k < count; ++k) {
+                    Z_c[k] = (Z_first[k] + Z[k]) / std::numbers::sqrt2_v<T>;
+                }
+                std::copy_n(X_c.begin(), count, prev_c.begin());
+                coarse->advance(j / 2, std::span<T>(X_c.data(), count), std::span<const T>(Z_c.data(), count), std::span<T>(sigma_c.data(), count));
+                if (payoff.asian) {
+                    add_spot(std::span<const T>(X_c.data(), count), std::span<T>(sum_c.data(), count));
+                }
+                else {
+                    // Coarse midpoint from the fine increments:
+                    // X_mid = (X + X') / 2 + σ_c √Δ (Z_first - Z) / 2, then a bridge per half
+                    for (size_t k{}; k < count; ++k) {
+                        mid[k] = (prev_c[k] + X_c[k]) / static_cast<T>(2) + sigma_c[k] * sqrt_dt * (Z_first[k] - Z[k]) / static_cast<T>(2);
+                    }
+                    survive(std::span<const T>(prev_c.data(), count), std::span<const T>(mid.data(), count),
+                        std::span<const T>(sigma_c.data(), count), std::span<T>(survival_c.data(), count));
+                    survive(std::span<const T>(mid.data(), count), std::span<const T>(X_c.data(), count),
+                        std::span<const T>(sigma_c.data(), count), std::span<T>(survival_c.data(), count));
+                }
+            }
+
+            // Step 3 - Payoffs P_l - P_l-1 (P_0 on level 0), discounted
+            // (work_2 holds S(T) / S0 of the path being valued)
+            const T discount = std::exp(-fine.risk_free_rate() * T_mat);
+            const T sign = payoff.call ? static_cast<T>(1) : static_cast<T>(-1);
+            const auto value = [&](T sum, T survival, size_t steps, size_t k) {
+                const T S_T = S0 * work_2[k];
+                if (payoff.asian) {
+                    // Trapezoid: (S0/2 + S_1 + ... + S_M-1 + S_M/2) / M
+                    const T average = (S0 * sum + (S0 - S_T) / static_cast<T>(2)) / static_cast<T>(steps);
+                    return std::max(sign * (average - payoff.K), T{});
+                }
+                const T live = payoff.knock_out ? survival : static_cast<T>(1) - survival;
+                return std::max(sign * (S_T - payoff.K), T{}) * live;
+            };
+
+            math::vexp(std::span<const T>(X_f.data(), count), std::span<T>(work_2.data(), count));
+            for (size_t k{}; k < count; ++k) {
+                work[k] = value(sum_f[k], survival_f[k], M, k);
+            }
+            if (coarse == nullptr) {
+                for (size_t k{}; k < count; ++k) acc.push(discount * work[k]);
+                return;
+            }
+            math::vexp(std::span<const T>(X_c.data(), count), std::span<T>(work_2.data(), count));
+            for (size_t k{}; k < count; ++k) {
+                acc.push(discount * (work[k] - value(sum_c[k], survival_c[k], M / 2, k)));
+            }
+        }
+
+        // Smallest adaptive batch per replicate: enough samples for a meaningful standard error
+        static constexpr size_t min_batch_samples = 64;
+
+        void check_sample_range(size_t samples) const {
+            if (config_.sampling == Sampling::Sobol && samples >= (size_t{ 1 } << random::SobolSequence::bits))
+                throw std::invalid_argument("Too many points per Sobol randomization");
+        }
     };
-} // namespace ito::method
\ No newline at end of file
+} // namespace ito::method
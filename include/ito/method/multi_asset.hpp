@@ -0,0 +1,172 @@
+#pragma once
+#include <ito/utils/math.hpp>
+#include <ito/utils/linalg.hpp>
+#include <ito/utils/vmath.hpp>
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+namespace ito::method {
+
+    // Payoff underlying of a multi-asset call/put
+    enum class MultiAssetPayoff {
+        Basket,   // Σ w_i S_i(T)
+        BestOf,   // max_i S_i(T)
+        WorstOf   // min_i S_i(T)
+    };
+
+    template<math::Arithmetic T = double>
+    struct MultiAssetCreateInfo {
+        std::vector<T> spot_prices;   // S_i - current prices of the n underlyings
+        std::vector<T> volatilities;  // σ_i - volatilities (annualized)
+        std::vector<T> correlation;   // ρ - n x n correlation matrix, row-major
+        T risk_free_rate;             // r - risk-free interest rate (annualized)
+        T time_to_maturity;           // T - time to expiration (in years)
+        size_t num_factors = 0;       // 0 = full Cholesky; k < n = top-k principal components
+
+        size_t num_assets() const noexcept { return spot_prices.size(); }
+
+        void validate() const {
+            const size_t n = num_assets();
+            if (n == 0)
+                throw std::invalid_argument("Multi-asset model needs at least one underlying");
+            if (volatilities.size() != n || correlation.size() != n * n)
+                throw std::invalid_argument("Volatilities and correlation must match the number of underlyings");
+            for (size_t i{}; i < n; ++i) {
+                if (spot_prices[i] <= 0)
+                    throw std::invalid_argument("Spot price must be positive");
+                if (volatilities[i] < 0)
+                    throw std::invalid_argument("Volatility cannot be negative");
+                if (correlation[i * n + i] != static_cast<T>(1))
+                    throw std::invalid_argument("Correlation matrix must have a unit diagonal");
+                for (size_t j{}; j < i; ++j) {
+                    const T rho = correlation[i * n + j];
+                    if (rho != correlation[j * n + i] || !(std::abs(rho) <= static_cast<T>(1)))
+                        throw std::invalid_argument("Correlation matrix must be symmetric with entries in [-1, 1]");
+                }
+            }
+            if (time_to_maturity <= 0)
+                throw std::invalid_argument("Time to maturity must be positive");
+            if (num_factors > n)
+                throw std::invalid_argument("Number of factors cannot exceed the number of underlyings");
+        }
+    };
+
+    /**
+     * Correlated terminal GBM prices for n underlyings from k independent normals
+     *     S_i(T) = S_i * exp((r - σ_i²/2) T + σ_i √T W_i),   W = L Z
+     * L (n x k) is factored once:
+     *   k = n - Cholesky factor of ρ (lower triangular, exact correlation)
+     *   k < n - top-k principal components √λ_j v_j, rows rescaled to unit
+     *           length so every marginal stays exactly lognormal; the
+     *           correlation is reproduced up to the dropped eigenvalues
+     *
+     * terminal() maps a block of normals to prices in batched matrix form:
+     * Z is factor-major (k x m), S is asset-major (n x m), and W = L Z is a
+     * sequence of unit-stride row updates that vectorize across paths. Callers
+     * own the buffers, so no allocation happens per path or per block.
+     */
+    template<math::Arithmetic T = double>
+    class CorrelatedGbm {
+    public:
+        explicit CorrelatedGbm(const MultiAssetCreateInfo<T>& info)
+            : spot_(info.spot_prices)
+        {
+            info.validate();
+
+            const size_t n = info.num_assets();
+            num_factors_ = info.num_factors == 0 ? n : info.num_factors;
+            loadings_.assign(n * num_factors_, T{});
+            row_length_.assign(n, num_factors_);
+
+            // Step 1 - Factor loadings L with L Lᵀ ≈ ρ
+            if (num_factors_ == n) {
+                std::vector<T> l(info.correlation);
+                if (!math::cholesky_decompose(std::span<T>(l), n))
+                    throw std::invalid_argument("Correlation matrix must be positive definite (use num_factors for PCA)");
+                for (size_t i{}; i < n; ++i) {
+                    row_length_[i] = i + 1;  // lower triangle: W_i needs Z_0..Z_i only
+                    for (size_t j{}; j <= i; ++j) loadings_[i * n + j] = l[i * n + j];
+                }
+            }
+            else {
+                std::vector<T> a(info.correlation);
+                std::vector<T> values(n);
+                std::vector<T> vectors(n * n);
+                math::symmetric_eigen(std::span<T>(a), n, std::span<T>(values), std::span<T>(vectors));
+
+                for (size_t i{}; i < n; ++i) {
+                    T norm{};
+                    for (size_t j{}; j < num_factors_; ++j) {
+                        const T l_ij = vectors[i * n + j] * std::sqrt(std::max(values[j], T{}));
+                        loadings_[i * num_factors_ + j] = l_ij;
+                        norm += l_ij * l_ij;
+                    }
+                    if (!(norm > 0))
+                        throw std::invalid_argument("Principal components leave an underlying without variance");
+                    for (size_t j{}; j < num_factors_; ++j) loadings_[i * num_factors_ + j] /= std::sqrt(norm);
+                }
+            }
+
+            // Step 2 - Per-asset drift (r - σ²/2) T and diffusion scale σ √T
+            drift_.resize(n);
+            vol_.resize(n);
+            for (size_t i{}; i < n; ++i) {
+                const T sigma = info.volatilities[i];
+                drift_[i] = (info.risk_free_rate - sigma * sigma / static_cast<T>(2)) * info.time_to_maturity;
+                vol_[i] = sigma * std::sqrt(info.time_to_maturity);
+            }
+        }
+
+        size_t num_assets() const noexcept { return spot_.size(); }
+        size_t num_factors() const noexcept { return num_factors_; }
+
+        // n x k row-major factor loadings
+        std::span<const T> loadings() const noexcept { return loadings_; }
+
+        /**
+         * Terminal prices of m paths: Z is k x m (factor-major), S is n x m
+         * (asset-major). mirror = true uses -Z (antithetic partners).
+         */
+        void terminal(std::span<const T> Z, std::span<T> S, size_t m, bool mirror = false) const {
+            const T sign = mirror ? static_cast<T>(-1) : static_cast<T>(1);
+
+            for (size_t i{}; i < num_assets(); ++i) {
+                const std::span<T> row = S.subspan(i * m, m);
+                const T* l = loadings_.data() + i * num_factors_;
+
+                // Step 1 - W_i = Σ_j L_ij Z_j, one axpy per factor
+                std::fill(row.begin(), row.end(), T{});
+                for (size_t j{}; j < row_length_[i]; ++j) {
+                    const T l_ij = l[j];
+                    const T* z = Z.data() + j * m;
+                    for (size_t p{}; p < m; ++p) {
+                        row[p] += l_ij * z[p];
+                    }
+                }
+
+                // Step 2 - S_i(T) = S_i * exp(drift + σ √T W_i), one SIMD exp pass
+                const T vol = sign * vol_[i];
+                for (size_t p{}; p < m; ++p) {
+                    row[p] = drift_[i] + vol * row[p];
+                }
+                math::vexp(std::span<const T>(row), row);
+                for (size_t p{}; p < m; ++p) {
+                    row[p] *= spot_[i];
+                }
+            }
+        }
+
+    private:
+        std::vector<T> spot_;
+        std::vector<T> drift_;
+        std::vector<T> vol_;
+        std::vector<T> loadings_;        // L, n x k row-major
+        std::vector<size_t> row_length_; // factors used by each asset (i + 1 for Cholesky)
+        size_t num_factors_ = 0;
+    };
+
+} // namespace ito::method
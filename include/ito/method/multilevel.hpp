@@ -0,0 +1,110 @@
+#pragma once
+#include <ito/utils/math.hpp>
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+namespace ito::method {
+
+    template<math::Arithmetic T = double>
+    struct MultilevelCreateInfo {
+        T target_rmse;                    // ε - target root-mean-square error of the price
+        size_t base_steps = 2;            // time steps on level 0; level l has base_steps * 2^l
+        size_t min_levels = 3;            // levels always simulated (0 .. min_levels - 1)
+        size_t max_levels = 12;           // hard cap on the finest level
+        size_t initial_samples = 5'000;   // pilot samples on every new level
+
+        void validate() const {
+            if (!(target_rmse > 0))
+                throw std::invalid_argument("Target RMSE must be positive");
+            if (base_steps == 0)
+                throw std::invalid_argument("Level 0 needs at least one time step");
+            if (min_levels < 2 || max_levels < min_levels)
+                throw std::invalid_argument("Need 2 <= min_levels <= max_levels");
+            if (max_levels > 24)
+                throw std::invalid_argument("At most 24 levels are supported");
+            if (initial_samples < 2)
+                throw std::invalid_argument("Need at least 2 pilot samples per level");
+        }
+    };
+
+    // Per-level statistics of the correction P_l - P_l-1 (P_0 on level 0)
+    template<math::Arithmetic T = double>
+    struct MultilevelLevel {
+        size_t num_steps;     // fine time steps of the level
+        size_t num_samples;   // N_l
+        T mean;               // E[P_l - P_l-1]
+        T variance;           // V[P_l - P_l-1]
+        T cost;               // time steps per sample (fine + coarse)
+    };
+
+    template<math::Arithmetic T = double>
+    struct MultilevelResult {
+        T price;              // Σ_l mean_l
+        T standard_error;     // √(Σ_l V_l / N_l)
+        T bias;               // estimated weak error of the finest level
+        bool converged;       // false if max_levels was hit with the bias above ε/√2
+        std::vector<MultilevelLevel<T>> levels;
+
+        T rmse() const noexcept {
+            return std::sqrt(standard_error * standard_error + bias * bias);
+        }
+
+        // Total time steps simulated, Σ_l N_l C_l
+        T cost() const noexcept {
+            T total{};
+            for (const auto& level : levels) {
+                total += static_cast<T>(level.num_samples) * level.cost;
+            }
+            return total;
+        }
+    };
+
+    /**
+     * Decay rate of |values[l]| ~ 2^(-rate l), least-squares fit of log2 over
+     * levels 1 .. L (level 0 is not a correction and is skipped); at least 0.5
+     */
+    template<math::Arithmetic T = double>
+    T multilevel_decay_rate(std::span<const T> values) {
+        T sum_l{}, sum_y{}, sum_ll{}, sum_ly{};
+        size_t n{};
+        for (size_t l = 1; l < values.size(); ++l) {
+            const T y = std::log2(std::max(std::abs(values[l]), std::numeric_limits<T>::min()));
+            const T x = static_cast<T>(l);
+            sum_l += x;
+            sum_y += y;
+            sum_ll += x * x;
+            sum_ly += x * y;
+            ++n;
+        }
+        if (n < 2) return static_cast<T>(0.5);
+
+        const T count = static_cast<T>(n);
+        const T slope = (count * sum_ly - sum_l * sum_y) / (count * sum_ll - sum_l * sum_l);
+        return std::max(-slope, static_cast<T>(0.5));
+    }
+
+    /**
+     * Optimal samples per level for a variance budget ε²/2 (Giles, 2008):
+     *     N_l = ⌈2/ε² √(V_l / C_l) Σ_k √(V_k C_k)⌉
+     */
+    template<math::Arithmetic T = double>
+    std::vector<size_t> multilevel_samples(std::span<const T> variances, std::span<const T> costs, T target_rmse) {
+        T sum{};
+        for (size_t l{}; l < variances.size(); ++l) {
+            sum += std::sqrt(variances[l] * costs[l]);
+        }
+
+        std::vector<size_t> samples(variances.size());
+        for (size_t l{}; l < variances.size(); ++l) {
+            const T N = std::ceil(static_cast<T>(2) / (target_rmse * target_rmse) * std::sqrt(variances[l] / costs[l]) * sum);
+            samples[l] = static_cast<size_t>(std::max(N, T{}));
+        }
+        return samples;
+    }
+
+} // namespace ito::method
@@ -0,0 +1,209 @@
+#pragma once
+#include <ito/utils/math.hpp>
+#include <ito/utils/random.hpp>
+#include <ito/utils/vmath.hpp>
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+namespace ito::method {
+
+    template<math::Arithmetic T = double>
+    struct GbmPathCreateInfo {
+        T spot_price;           // S0 - price at t = 0
+        T risk_free_rate;       // r - risk-free interest rate (annualized)
+        T volatility;           // σ (sigma) - volatility (annualized)
+        std::vector<T> times;   // observation times t_1 < ... < t_n (years)
+
+        void validate() const {
+            if (spot_price <= 0)
+                throw std::invalid_argument("Spot price must be positive");
+            if (volatility < 0)
+                throw std::invalid_argument("Volatility cannot be negative");
+            if (times.empty())
+                throw std::invalid_argument("Time grid needs at least one observation time");
+            for (size_t s{}; s < times.size(); ++s) {
+                if (!(times[s] > (s == 0 ? T{} : times[s - 1])))
+                    throw std::invalid_argument("Observation times must be positive and strictly increasing");
+            }
+        }
+    };
+
+    // `steps` equally spaced observation times: maturity/steps, 2*maturity/steps, ..., maturity
+    template<math::Arithmetic T = double>
+    std::vector<T> uniform_time_grid(T maturity, size_t steps) {
+        if (!(maturity > 0) || steps == 0)
+            throw std::invalid_argument("Uniform time grid needs a positive maturity and at least one step");
+
+        std::vector<T> times(steps);
+        for (size_t s{}; s < steps; ++s) {
+            times[s] = maturity * static_cast<T>(s + 1) / static_cast<T>(steps);
+        }
+        return times;
+    }
+
+    /**
+     * Non-owning view of a block of paths, structure-of-arrays, time-major:
+     *     value(path p, step s) = data[s * num_paths + p]
+     * All paths of one step are contiguous, so payoff kernels stream through
+     * a step with unit stride (and vectorize across paths).
+     */
+    template<math::Arithmetic T = double>
+    class PathView {
+    public:
+        PathView(std::span<const T> data, size_t num_paths, size_t num_steps) noexcept
+            : data_(data), num_paths_(num_paths), num_steps_(num_steps)
+        {
+        }
+
+        size_t num_paths() const noexcept { return num_paths_; }
+        size_t num_steps() const noexcept { return num_steps_; }
+        std::span<const T> data() const noexcept { return data_; }
+
+        // Every path at observation `s`
+        std::span<const T> step(size_t s) const noexcept {
+            return data_.subspan(s * num_paths_, num_paths_);
+        }
+
+        T operator()(size_t path, size_t s) const noexcept {
+            return data_[s * num_paths_ + path];
+        }
+
+    private:
+        std::span<const T> data_;
+        size_t num_paths_;
+        size_t num_steps_;
+    };
+
+    // Owning block of paths in the same layout
+    template<math::Arithmetic T = double>
+    struct PathSet {
+        std::vector<T> values;
+        size_t num_paths = 0;
+        size_t num_steps = 0;
+
+        PathView<T> view() const noexcept { return { values, num_paths, num_steps }; }
+    };
+
+    /**
+     * Multi-step GBM path generator on an arbitrary time grid
+     * S(t_s) = S(t_s-1) * exp((r - σ²/2) Δt_s + σ √Δt_s Z_s), exact at every step.
+     *
+     * The step-s normal of path p is the counter draw (index p, dimension s),
+     * so any split of the path range into tiles, chunks or threads reproduces
+     * the same paths - and the same paths as MonteCarloPricer's grid engine
+     * for the same seed and times.
+     *
+     * Two modes:
+     *   simulate()      - materialize a range of paths (count x steps values)
+     *   for_each_tile() - stream a range through a callback, one tile of
+     *                     paths at a time; only one tile is ever stored
+     */
+    template<math::Arithmetic T = double>
+    class GbmPathEngine {
+    public:
+        // Paths per tile: 256 paths x 252 daily steps is ~0.5 MB (fits in L2)
+        static constexpr size_t default_tile_size = 256;
+
+        GbmPathEngine(const GbmPathCreateInfo<T>& info, unsigned seed)
+            : S0_(info.spot_price)
+            , times_(info.times)
+            , stream_(seed)
+        {
+            info.validate();
+
+            // Precompute the per-step drift and diffusion scale
+            drift_.reserve(times_.size());
+            vol_.reserve(times_.size());
+            for (size_t s{}; s < times_.size(); ++s) {
+                const T dt = times_[s] - (s == 0 ? T{} : times_[s - 1]);
+                drift_.push_back((info.risk_free_rate - info.volatility * info.volatility / static_cast<T>(2)) * dt);
+                vol_.push_back(info.volatility * std::sqrt(dt));
+            }
+        }
+
+        size_t num_steps() const noexcept { return times_.size(); }
+        std::span<const T> times() const noexcept { return times_; }
+        T spot_price() const noexcept { return S0_; }
+
+        /**
+         * Paths [first, first + count) into `out` (time-major, count x num_steps)
+         * mirror = true drives the same paths with -Z (antithetic partners).
+         */
+        void generate(std::span<T> out, size_t first, size_t count, bool mirror = false) const {
+            if (out.size() < count * num_steps())
+                throw std::invalid_argument("Path buffer is smaller than count x num_steps");
+
+            const T sign = mirror ? static_cast<T>(-1) : static_cast<T>(1);
+            std::array<T, block_size> X;  // running log-return, stays in L1
+
+            for (size_t b{}; b < count; b += block_size) {
+                const size_t n = std::min(block_size, count - b);
+                std::fill_n(X.begin(), n, T{});
+
+                for (size_t s{}; s < num_steps(); ++s) {
+                    const std::span<T> row = out.subspan(s * count + b, n);
+
+                    // Step 1 - Normals straight into the output row
+                    stream_.fill_normal(row, first + b, static_cast<std::uint32_t>(s));
+
+                    // Step 2 - Accumulate the log-return to t_s
+                    const T vol = sign * vol_[s];
+                    for (size_t k{}; k < n; ++k) {
+                        X[k] += drift_[s] + vol * row[k];
+                    }
+
+                    // Step 3 - S(t_s) = S0 * exp(X), one SIMD exp pass per row
+                    math::vexp(std::span<const T>(X.data(), n), row);
+                    for (size_t k{}; k < n; ++k) {
+                        row[k] *= S0_;
+                    }
+                }
+            }
+        }
+
+        // Materialize paths [first, first + count)
+        PathSet<T> simulate(size_t first, size_t count, bool mirror = false) const {
+            PathSet<T> paths{
+                .values = std::vector<T>(count * num_steps()),
+                .num_paths = count,
+                .num_steps = num_steps()
+            };
+            generate(paths.values, first, count, mirror);
+            return paths;
+        }
+
+        /**
+         * Block mode: call f(PathView tile, size_t first_path) for consecutive
+         * tiles of paths [first, first + count); one tile buffer is reused
+         */
+        template<typename Function>
+        void for_each_tile(size_t first, size_t count, Function&& f, size_t tile_size = default_tile_size) const {
+            if (tile_size == 0)
+                throw std::invalid_argument("Tile size must be positive");
+
+            std::vector<T> tile(std::min(tile_size, count) * num_steps());
+            for (size_t p{}; p < count; p += tile_size) {
+                const size_t n = std::min(tile_size, count - p);
+                generate(tile, first + p, n);
+                f(PathView<T>(std::span<const T>(tile.data(), n * num_steps()), n, num_steps()), first + p);
+            }
+        }
+
+    private:
+        // Paths whose log-return is carried across steps at once
+        static constexpr size_t block_size = 256;
+
+        T S0_;
+        std::vector<T> times_;
+        std::vector<T> drift_;
+        std::vector<T> vol_;
+        random::CounterRng<T> stream_;
+    };
+
+} // namespace ito::method
@@ -0,0 +1,223 @@
+#pragma once
+#include <ito/utils/math.hpp>
+#include <ito/method/monte_carlo.hpp>
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <execution>
+#include <numeric>
+#include <span>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace ito::method {
+
+    // Absolute shift of one input
+    template<math::Arithmetic T = double>
+    struct Bump {
+        size_t input;   // index into the inputs
+        T shift;
+    };
+
+    // One revaluation: the base inputs with every bump applied (none = base)
+    template<math::Arithmetic T = double>
+    struct BumpScenario {
+        std::vector<Bump<T>> bumps;
+    };
+
+    template<math::Arithmetic T = double>
+    struct RiskCreateInfo {
+        using ExecutionPolicy = typename MonteCarloCreateInfo<T>::ExecutionPolicy;
+
+        std::vector<T> inputs;                                 // base market inputs (spot, vol, rate, ...)
+        std::vector<T> bump_sizes;                             // h per input; 0 = not bumped
+        std::vector<std::pair<size_t, size_t>> cross_gammas;   // input pairs (i, j) for ∂²V/∂x_i∂x_j
+        ExecutionPolicy policy = ExecutionPolicy::Auto;        // how scenarios are scheduled
+
+        void validate() const {
+            if (inputs.empty())
+                throw std::invalid_argument("Risk run needs at least one input");
+            if (bump_sizes.size() != inputs.size())
+                throw std::invalid_argument("Need one bump size per input");
+            for (const T h : bump_sizes) {
+                if (h < 0)
+                    throw std::invalid_argument("Bump sizes cannot be negative");
+            }
+            for (const auto& [i, j] : cross_gammas) {
+                if (i >= inputs.size() || j >= inputs.size() || i == j)
+                    throw std::invalid_argument("Cross gamma needs two distinct inputs");
+                if (!(bump_sizes[i] > 0) || !(bump_sizes[j] > 0))
+                    throw std::invalid_argument("Cross gamma inputs must both be bumped");
+            }
+        }
+    };
+
+    // Central finite-difference risk; entries of unbumped inputs are 0
+    template<math::Arithmetic T = double>
+    struct RiskResult {
+        T price;
+        std::vector<T> delta;        // (V(x + h) - V(x - h)) / 2h, per input
+        std::vector<T> gamma;        // (V(x + h) - 2 V(x) + V(x - h)) / h², per input
+        std::vector<T> cross_gamma;  // (V(++) - V(+-) - V(-+) + V(--)) / 4 h_i h_j, per pair
+        size_t num_scenarios = 0;    // revaluations, base included
+    };
+
+    /**
+     * Bump-and-revalue risk with common random numbers
+     * Every scenario is priced by price(const MonteCarloPricer<T>&, inputs)
+     * with a FRESH pricer built from the same MonteCarloCreateInfo, hence
+     * the same seed: the counter-based streams (and the mt19937 of the
+     * legacy path) replay the same draws in every scenario, so the Monte
+     * Carlo noise cancels in the differences and a bump of size h carries
+     * an error of O(h) rather than O(1/h) times the price error.
+     *
+     *     RiskRunner<double> runner({ .num_simulations = 1'000'000, .seed = 42 });
+     *     const auto risk = runner.run({
+     *             .inputs = { S0, sigma, r },
+     *             .bump_sizes = { 1.0, 0.01, 0.001 },
+     *             .cross_gammas = { { 0, 1 } } },   // vanna
+     *         [&](const MonteCarloPricer<double>& mc, std::span<const double> x) {
+     *             return mc.price_european_call_and_put(x[0], K, x[2], x[1], T).call.price;
+     *         });
+     *
+     * The scenarios are independent, so they are scheduled across cores;
+     * results do not depend on the schedule. The closure may ignore the
+     * pricer (analytic models) and must be safe to call concurrently.
+     * Adaptive stopping (target_standard_error, max_wall_time) is rejected:
+     * scenarios would stop at different path counts (or at times that depend
+     * on the schedule) and no longer share their random numbers.
+     */
+    template<math::Arithmetic T = double>
+    class RiskRunner {
+    public:
+        using ExecutionPolicy = typename MonteCarloCreateInfo<T>::ExecutionPolicy;
+
+        explicit RiskRunner(const MonteCarloCreateInfo<T>& config = {})
+            : config_(config)
+        {
+            if (config_.target_standard_error > 0 || config_.max_wall_time.count() > 0)
+                throw std::invalid_argument("Risk runs need a fixed path count: adaptive stopping breaks common random numbers");
+        }
+
+        const MonteCarloCreateInfo<T>& config() const noexcept { return config_; }
+
+        /**
+         * Value of every scenario, in order
+         * price(const MonteCarloPricer<T>& pricer, std::span<const T> inputs) -> T
+         * An exception thrown while pricing a scenario (e.g. a bump that takes
+         * a volatility below zero) is caught per scenario, so it cannot escape
+         * a parallel algorithm and terminate; once every scenario has run, the
+         * one of the lowest-numbered failing scenario is rethrown.
+         */
+        template<typename Pricing>
+        std::vector<T> revalue(
+            std::span<const T> inputs,
+            std::span<const BumpScenario<T>> scenarios,
+            Pricing&& price,
+            ExecutionPolicy policy = ExecutionPolicy::Auto
+        ) const {
+            for (const BumpScenario<T>& scenario : scenarios) {
+                for (const Bump<T>& bump : scenario.bumps) {
+                    if (bump.input >= inputs.size())
+                        throw std::invalid_argument("Bump refers to an unknown input");
+                }
+            }
+
+            std::vector<T> values(scenarios.size());
+            std::vector<std::exception_ptr> errors(scenarios.size());
+            const auto body = [&](size_t s) {
+                try {
+                    std::vector<T> x(inputs.begin(), inputs.end());
+                    for (const Bump<T>& bump : scenarios[s].bumps) {
+                        x[bump.input] += bump.shift;
+                    }
+                    const MonteCarloPricer<T> pricer(config_);  // same seed: common random numbers
+                    values[s] = price(pricer, std::span<const T>(x));
+                }
+                catch (...) {
+                    errors[s] = std::current_exception();
+                }
+            };
+
+            std::vector<size_t> order(scenarios.size());
+            std::iota(order.begin(), order.end(), size_t{});
+            const bool parallel = policy == ExecutionPolicy::Parallel
+                || (policy == ExecutionPolicy::Auto && scenarios.size() > 1);
+            if (parallel) {
+                std::for_each(std::execution::par, order.begin(), order.end(), body);
+            }
+            else {
+                std::for_each(std::execution::seq, order.begin(), order.end(), body);
+            }
+
+            for (const std::exception_ptr& error : errors) {
+                if (error) std::rethrow_exception(error);
+            }
+            return values;
+        }
+
+        /**
+         * Price, delta and gamma of every bumped input and the requested
+         * cross gammas from one batch of scenarios:
+         * base, then x_i ± h_i per bumped input, then (±h_i, ±h_j) per pair
+         */
+        template<typename Pricing>
+        RiskResult<T> run(const RiskCreateInfo<T>& info, Pricing&& price) const {
+            info.validate();
+
+            // Step 1 - Scenarios
+            const size_t n = info.inputs.size();
+            std::vector<BumpScenario<T>> scenarios(1);  // base
+            std::vector<size_t> up(n), down(n);         // scenario index per bumped input
+            for (size_t i{}; i < n; ++i) {
+                const T h = info.bump_sizes[i];
+                if (!(h > 0)) continue;
+                up[i] = scenarios.size();
+                scenarios.push_back({ { { i, h } } });
+                down[i] = scenarios.size();
+                scenarios.push_back({ { { i, -h } } });
+            }
+
+            const size_t first_cross = scenarios.size();
+            for (const auto& [i, j] : info.cross_gammas) {
+                const T h_i = info.bump_sizes[i];
+                const T h_j = info.bump_sizes[j];
+                scenarios.push_back({ { { i, h_i }, { j, h_j } } });
+                scenarios.push_back({ { { i, h_i }, { j, -h_j } } });
+                scenarios.push_back({ { { i, -h_i }, { j, h_j } } });
+                scenarios.push_back({ { { i, -h_i }, { j, -h_j } } });
+            }
+
+            // Step 2 - Revalue all of them at once
+            const std::vector<T> V = revalue(std::span<const T>(info.inputs), std::span<const BumpScenario<T>>(scenarios),
+                price, info.policy);
+
+            // Step 3 - Central differences
+            RiskResult<T> result{
+                .price = V.front(),
+                .delta = std::vector<T>(n),
+                .gamma = std::vector<T>(n),
+                .cross_gamma = {},
+                .num_scenarios = scenarios.size()
+            };
+            for (size_t i{}; i < n; ++i) {
+                const T h = info.bump_sizes[i];
+                if (!(h > 0)) continue;
+                result.delta[i] = (V[up[i]] - V[down[i]]) / (static_cast<T>(2) * h);
+                result.gamma[i] = (V[up[i]] - static_cast<T>(2) * V.front() + V[down[i]]) / (h * h);
+            }
+            for (size_t c{}; c < info.cross_gammas.size(); ++c) {
+                const auto [i, j] = info.cross_gammas[c];
+                const T* v = V.data() + first_cross + 4 * c;
+                result.cross_gamma.push_back((v[0] - v[1] - v[2] + v[3])
+                    / (static_cast<T>(4) * info.bump_sizes[i] * info.bump_sizes[j]));
+            }
+            return result;
+        }
+
+    private:
+        MonteCarloCreateInfo<T> config_;
+    };
+
+} // namespace ito::method
@@ -0,0 +1,267 @@
+#pragma once
+#include <ito/utils/math.hpp>
+#include <ito/utils/linalg.hpp>
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <span>
+
+namespace ito::method {
+
+    /**
+     * Single-pass, mergeable mean/variance accumulator
+     * push():  Welford (1962) update, numerically stable for long streams
+     * merge(): Chan, Golub & LeVeque (1979) pairwise combination
+     *
+     * Engines keep one accumulator per work item and merge them afterwards,
+     * so no sample ever has to be stored.
+     */
+    template<math::Arithmetic T = double>
+    class RunningStatistics {
+    public:
+        void push(T x) noexcept {
+            ++count_;
+            const T delta = x - mean_;
+            mean_ += delta / static_cast<T>(count_);
+            m2_ += delta * (x - mean_);
+        }
+
+        void merge(const RunningStatistics& other) noexcept {
+            if (other.count_ == 0) return;
+            if (count_ == 0) {
+                *this = other;
+                return;
+            }
+            const T n_a = static_cast<T>(count_);
+            const T n_b = static_cast<T>(other.count_);
+            const T n = n_a + n_b;
+            const T delta = other.mean_ - mean_;
+
+            mean_ += delta * (n_b / n);
+            m2_ += other.m2_ + delta * delta * (n_a * n_b / n);
+            count_ += other.count_;
+        }
+
+        size_t count() const noexcept { return count_; }
+        T mean() const noexcept { return mean_; }
+
+        // Unbiased sample variance: M2 / (N-1)
+        T variance() const noexcept {
+            return count_ > 1 ? m2_ / static_cast<T>(count_ - 1) : static_cast<T>(0);
+        }
+
+        // Standard error of the mean: sqrt(variance / N)
+        T standard_error() const noexcept {
+            using std::sqrt;
+            return count_ > 0 ? sqrt(variance() / static_cast<T>(count_)) : static_cast<T>(0);
+        }
+
+    private:
+        size_t count_ = 0;
+        T mean_ = static_cast<T>(0);
+        T m2_ = static_cast<T>(0);  // Σ(x - mean)²
+    };
+
+    /**
+     * Mergeable accumulator for samples that arrive as batch means
+     * push(x, n) adds the mean x of a batch of n samples; the running mean is
+     * weighted by n, so it equals the mean over all samples however the
+     * batches were cut. The per-sample variance is estimated by the
+     * batch-means method, Σ n_b (x_b - mean)² / (B - 1), which is unbiased
+     * for independent samples whatever the batch sizes.
+     */
+    template<math::Arithmetic T = double>
+    class BatchStatistics {
+    public:
+        void push(T x, size_t n) noexcept {
+            if (n == 0) return;
+            ++batches_;
+            count_ += n;
+            const T weight = static_cast<T>(n);
+            const T delta = x - mean_;
+            mean_ += delta * (weight / static_cast<T>(count_));
+            m2_ += weight * delta * (x - mean_);
+        }
+
+        void merge(const BatchStatistics& other) noexcept {
+            if (other.count_ == 0) return;
+            if (count_ == 0) {
+                *this = other;
+                return;
+            }
+            const T n_a = static_cast<T>(count_);
+            const T n_b = static_cast<T>(other.count_);
+            const T n = n_a + n_b;
+            const T delta = other.mean_ - mean_;
+            mean_ += delta * (n_b / n);
+            m2_ += other.m2_ + delta * delta * (n_a * n_b / n);
+            count_ += other.count_;
+            batches_ += other.batches_;
+        }
+
+        size_t count() const noexcept { return count_; }
+        size_t batches() const noexcept { return batches_; }
+        T mean() const noexcept { return mean_; }
+
+        // Per-sample variance from the spread of the batch means
+        T variance() const noexcept {
+            return batches_ > 1 ? m2_ / static_cast<T>(batches_ - 1) : static_cast<T>(0);
+        }
+
+        // Standard error of the mean: sqrt(variance / N)
+        T standard_error() const noexcept {
+            using std::sqrt;
+            return count_ > 0 ? sqrt(variance() / static_cast<T>(count_)) : static_cast<T>(0);
+        }
+
+    private:
+        size_t batches_ = 0;
+        size_t count_ = 0;
+        T mean_ = static_cast<T>(0);
+        T m2_ = static_cast<T>(0);  // Σ n_b (x_b - mean)²
+    };
+
+    /**
+     * Single-pass, mergeable control-variate estimator
+     * Tracks the means of a response Y and of NumControls controls X with known
+     * expectations, plus their co-moments (multivariate Welford / Chan update).
+     * The optimal coefficient beta = Cov(X)^-1 Cov(X, Y) is therefore available
+     * at any point in the stream, and the variance-reduced estimate is
+     *     mean(Y) - beta . (mean(X) - E[X])
+     * with standard error from the regression residual variance.
+     */
+    template<math::Arithmetic T = double, size_t NumControls = 1>
+    class ControlVariateStatistics {
+    public:
+        using controls_type = std::array<T, NumControls>;
+
+        void push(T y, const controls_type& x) noexcept {
+            ++count_;
+            const T n = static_cast<T>(count_);
+
+            // Deltas against the old means, then update the means
+            controls_type dx;
+            for (size_t j{}; j < NumControls; ++j) {
+                dx[j] = x[j] - mean_x_[j];
+                mean_x_[j] += dx[j] / n;
+            }
+            const T dy = y - mean_y_;
+            mean_y_ += dy / n;
+
+            // Co-moments use one old and one new delta (exact Welford form)
+            const T dy_new = y - mean_y_;
+            for (size_t j{}; j < NumControls; ++j) {
+                for (size_t k{}; k < NumControls; ++k) {
+                    c_xx_[j][k] += dx[j] * (x[k] - mean_x_[k]);
+                }
+                c_xy_[j] += dx[j] * dy_new;
+            }
+            c_yy_ += dy * dy_new;
+        }
+
+        void merge(const ControlVariateStatistics& other) noexcept {
+            if (other.count_ == 0) return;
+            if (count_ == 0) {
+                *this = other;
+                return;
+            }
+            const T n_a = static_cast<T>(count_);
+            const T n_b = static_cast<T>(other.count_);
+            const T n = n_a + n_b;
+            const T w = n_a * n_b / n;
+
+            controls_type dx;
+            for (size_t j{}; j < NumControls; ++j) {
+                dx[j] = other.mean_x_[j] - mean_x_[j];
+            }
+            const T dy = other.mean_y_ - mean_y_;
+
+            for (size_t j{}; j < NumControls; ++j) {
+                for (size_t k{}; k < NumControls; ++k) {
+                    c_xx_[j][k] += other.c_xx_[j][k] + dx[j] * dx[k] * w;
+                }
+                c_xy_[j] += other.c_xy_[j] + dx[j] * dy * w;
+                mean_x_[j] += dx[j] * (n_b / n);
+            }
+            c_yy_ += other.c_yy_ + dy * dy * w;
+            mean_y_ += dy * (n_b / n);
+            count_ += other.count_;
+        }
+
+        size_t count() const noexcept { return count_; }
+
+        // Plain sample mean of Y (no variance reduction)
+        T raw_mean() const noexcept { return mean_y_; }
+
+        // Optimal regression coefficients; zero if Cov(X) is singular
+        controls_type beta() const noexcept {
+            std::array<T, NumControls * NumControls> cov{};
+            controls_type b{};
+            for (size_t j{}; j < NumControls; ++j) {
+                for (size_t k{}; k < NumControls; ++k) {
+                    cov[j * NumControls + k] = c_xx_[j][k];
+                }
+                b[j] = c_xy_[j];
+            }
+            if (!math::cholesky_decompose(std::span<T>(cov), NumControls)) {
+                return controls_type{};
+            }
+            math::cholesky_solve(std::span<const T>(cov), NumControls, std::span<T>(b));
+            return b;
+        }
+
+        // Variance-reduced mean: mean(Y) - beta . (mean(X) - E[X])
+        T mean(const controls_type& expected) const noexcept {
+            const controls_type b = beta();
+            T adjusted = mean_y_;
+            for (size_t j{}; j < NumControls; ++j) {
+                adjusted -= b[j] * (mean_x_[j] - expected[j]);
+            }
+            return adjusted;
+        }
+
+        // Residual variance: (Syy - beta . Sxy) / (N - 1 - NumControls)
+        T variance() const noexcept {
+            if (count_ <= NumControls + 1) return static_cast<T>(0);
+            const controls_type b = beta();
+            T residual = c_yy_;
+            for (size_t j{}; j < NumControls; ++j) {
+                residual -= b[j] * c_xy_[j];
+            }
+            return std::max(residual, T{}) / static_cast<T>(count_ - 1 - NumControls);
+        }
+
+        T standard_error() const noexcept {
+            using std::sqrt;
+            return count_ > 0 ? sqrt(variance() / static_cast<T>(count_)) : static_cast<T>(0);
+        }
+
+    private:
+        size_t count_ = 0;
+        T mean_y_ = static_cast<T>(0);
+        controls_type mean_x_{};
+        T c_yy_ = static_cast<T>(0);                                   // Σ(y - ȳ)²
+        controls_type c_xy_{};                                         // Σ(x - x̄)(y - ȳ)
+        std::array<std::array<T, NumControls>, NumControls> c_xx_{};   // Σ(x - x̄)(x - x̄)ᵀ
+    };
+
+    /**
+     * Merge accumulators in a fixed binary tree: (0,1), (2,3), ... then (0,2), ...
+     * The shape depends only on parts.size(), so the result is bit-identical
+     * however the parts were produced, and rounding error grows with log(n).
+     * Works for any type with merge(const Acc&); parts is used as scratch.
+     */
+    template<typename Accumulator>
+    Accumulator merge_pairwise(std::span<Accumulator> parts) {
+        if (parts.empty()) return Accumulator{};
+
+        for (size_t stride = 1; stride < parts.size(); stride *= 2) {
+            for (size_t i{}; i + stride < parts.size(); i += 2 * stride) {
+                parts[i].merge(parts[i + stride]);
+            }
+        }
+        return parts.front();
+    }
+
+} // namespace ito::method
@@ -0,0 +1,100 @@
+#pragma once
+#include <ito/utils/math.hpp>
+#include <ito/method/longstaff_schwartz.hpp>
+#include <algorithm>
+#include <concepts>
+#include <stdexcept>
+
+namespace ito::method {
+
+    // How MonteCarloPricer::price_terminal_greeks differentiates a payoff
+    enum class GreekEstimator {
+        LikelihoodRatio,  // score-function weights on the whole payoff
+        Mixed             // pathwise on the smooth part, likelihood ratio on the jumps
+    };
+
+    /**
+     * Payoff f(S(T)) of a European-style position, split for the Greek
+     * estimators as f = smooth + (f - smooth): `smooth` is the Lipschitz part,
+     * differentiated pathwise through smooth_derivative(); the remainder holds
+     * the jumps and is only ever weighted by likelihood ratios.
+     */
+    template<typename Payoff, typename T>
+    concept TerminalPayoff = math::Arithmetic<T> && requires(const Payoff& payoff, T S) {
+        { payoff(S) } -> std::convertible_to<T>;
+        { payoff.smooth(S) } -> std::convertible_to<T>;
+        { payoff.smooth_derivative(S) } -> std::convertible_to<T>;
+    };
+
+    // Plain call or put: all smooth
+    template<math::Arithmetic T = double>
+    struct VanillaPayoff {
+        T strike;
+        OptionType type = OptionType::Call;
+
+        void validate() const {
+            if (strike <= 0)
+                throw std::invalid_argument("Strike price must be positive");
+        }
+
+        T operator()(T S) const noexcept {
+            return type == OptionType::Call ? std::max(S - strike, T{}) : std::max(strike - S, T{});
+        }
+
+        T smooth(T S) const noexcept { return (*this)(S); }
+
+        T smooth_derivative(T S) const noexcept {
+            if (type == OptionType::Call) return S > strike ? static_cast<T>(1) : T{};
+            return S < strike ? static_cast<T>(-1) : T{};
+        }
+    };
+
+    enum class DigitalSettlement {
+        CashOrNothing,   // pays `cash` in the money
+        AssetOrNothing   // pays S(T) in the money
+    };
+
+    /**
+     * Binary call or put
+     * Cash-or-nothing is a pure jump (no smooth part). Asset-or-nothing is
+     * split so the jump part is never larger than the payoff itself:
+     *     call: S 1{S > K} = (S - K)+ + K 1{S > K}
+     *     put:  S 1{S < K} = min(S, K - S)+ + (2S - K) 1{K/2 < S < K}
+     * (the put's tent is S up to K/2, then falls to 0 at K). Splitting the
+     * put as K 1{S < K} - (K - S)+ instead would put a jump of K on every
+     * path below K, and its likelihood-ratio Greeks would be noisier than
+     * those of the whole payoff.
+     */
+    template<math::Arithmetic T = double>
+    struct DigitalPayoff {
+        T strike;
+        OptionType type = OptionType::Call;
+        DigitalSettlement settlement = DigitalSettlement::CashOrNothing;
+        T cash = static_cast<T>(1);
+
+        void validate() const {
+            if (strike <= 0)
+                throw std::invalid_argument("Strike price must be positive");
+        }
+
+        T operator()(T S) const noexcept {
+            const bool in_the_money = type == OptionType::Call ? S > strike : S < strike;
+            if (!in_the_money) return T{};
+            return settlement == DigitalSettlement::CashOrNothing ? cash : S;
+        }
+
+        T smooth(T S) const noexcept {
+            if (settlement == DigitalSettlement::CashOrNothing) return T{};
+            if (type == OptionType::Call) return std::max(S - strike, T{});
+            return std::max(std::min(S, strike - S), T{});
+        }
+
+        T smooth_derivative(T S) const noexcept {
+            if (settlement == DigitalSettlement::CashOrNothing) return T{};
+            if (type == OptionType::Call) return S > strike ? static_cast<T>(1) : T{};
+            if (S < strike / static_cast<T>(2)) return static_cast<T>(1);
+            return S < strike ? static_cast<T>(-1) : T{};
+        }
+    };
+
+} // namespace ito::method
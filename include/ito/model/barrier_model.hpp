@@ -0,0 +1,135 @@
+#pragma once
+#include <ito/utils/math.hpp>
+#include <ito/model/black_scholes_model.hpp>
+#include <cmath>
+#include <stdexcept>
+
+namespace ito::model {
+
+    enum class BarrierType {
+        DownAndOut,  // dies if S touches H from above
+        DownAndIn,   // comes alive if S touches H from above
+        UpAndOut,    // dies if S touches H from below
+        UpAndIn      // comes alive if S touches H from below
+    };
+
+    template<math::Arithmetic T = double>
+    struct BarrierCreateInfo {
+        T spot_price;           // S - current price of underlying
+        T strike_price;         // K - strike/exercise price
+        T barrier;              // H - barrier level (no rebate)
+        T risk_free_rate;       // r - risk-free interest rate (annualized)
+        T volatility;           // σ (sigma) - volatility (annualized)
+        T time_to_maturity;     // T - time to expiration (in years)
+        BarrierType type = BarrierType::DownAndOut;
+
+        constexpr bool is_down() const {
+            return type == BarrierType::DownAndOut || type == BarrierType::DownAndIn;
+        }
+
+        constexpr bool is_knock_out() const {
+            return type == BarrierType::DownAndOut || type == BarrierType::UpAndOut;
+        }
+
+        constexpr void validate() const {
+            if (spot_price <= 0)
+                throw std::invalid_argument("Spot price must be positive");
+            if (strike_price <= 0)
+                throw std::invalid_argument("Strike price must be positive");
+            if (barrier <= 0)
+                throw std::invalid_argument("Barrier must be positive");
+            if (volatility <= 0)
+                throw std::invalid_argument("Volatility must be positive for barrier options");
+            if (time_to_maturity <= 0)
+                throw std::invalid_argument("Time to maturity must be positive");
+        }
+    };
+
+    /**
+     * Continuously monitored single-barrier options under Black-Scholes
+     * Reiner & Rubinstein (1991), in the A-D notation of Haug, "The Complete
+     * Guide to Option Pricing Formulas" (2007), section 4.17.1, no rebate,
+     * no dividends. A barrier already breached at t = 0 makes knock-outs
+     * worthless and knock-ins plain vanillas.
+     */
+    template<math::Arithmetic T = double>
+    class BarrierModel {
+    private:
+        BarrierCreateInfo<T> info_;
+
+        // phi = +1 for the call, -1 for the put
+        T price(T phi) const {
+            const T S = info_.spot_price;
+            const T K = info_.strike_price;
+            const T H = info_.barrier;
+            const T r = info_.risk_free_rate;
+            const T sigma = info_.volatility;
+            const T time = info_.time_to_maturity;
+            const bool down = info_.is_down();
+            const bool knock_out = info_.is_knock_out();
+
+            const BlackScholesModel<T> vanilla({ S, K, r, sigma, time });
+            const T vanilla_price = phi > 0 ? vanilla.call_price() : vanilla.put_price();
+
+            // Already breached: the barrier event has happened
+            if (down ? S <= H : S >= H) {
+                return knock_out ? T{} : vanilla_price;
+            }
+
+            // Step 1 - Shared terms, mu = (r - σ²/2) / σ²; eta = +1 down, -1 up
+            const T eta = down ? static_cast<T>(1) : static_cast<T>(-1);
+            const T sigma_sqrt_T = sigma * std::sqrt(time);
+            const T mu = (r - sigma * sigma / static_cast<T>(2)) / (sigma * sigma);
+            const T shift = (static_cast<T>(1) + mu) * sigma_sqrt_T;
+            const T DF = std::exp(-r * time);
+            const T H_S = H / S;
+            const T pow_mu1 = std::pow(H_S, static_cast<T>(2) * (mu + static_cast<T>(1)));
+            const T pow_mu = std::pow(H_S, static_cast<T>(2) * mu);
+
+            const T x1 = std::log(S / K) / sigma_sqrt_T + shift;
+            const T x2 = std::log(S / H) / sigma_sqrt_T + shift;
+            const T y1 = std::log(H * H / (S * K)) / sigma_sqrt_T + shift;
+            const T y2 = std::log(H / S) / sigma_sqrt_T + shift;
+
+            // Step 2 - Haug's A-D terms
+            auto Phi = ito::math::normal_cdf<T>;
+            const T A = phi * S * Phi(phi * x1) - phi * K * DF * Phi(phi * x1 - phi * sigma_sqrt_T);
+            const T B = phi * S * Phi(phi * x2) - phi * K * DF * Phi(phi * x2 - phi * sigma_sqrt_T);
+            const T C = phi * S * pow_mu1 * Phi(eta * y1) - phi * K * DF * pow_mu * Phi(eta * y1 - eta * sigma_sqrt_T);
+            const T D = phi * S * pow_mu1 * Phi(eta * y2) - phi * K * DF * pow_mu * Phi(eta * y2 - eta * sigma_sqrt_T);
+
+            // Step 3 - Knock-in price by case; knock-out by in-out parity
+            const bool call = phi > 0;
+            const bool strike_above = K > H;
+            T knock_in;
+            if (call) {
+                knock_in = down
+                    ? (strike_above ? C : A - B + D)
+                    : (strike_above ? A : B - C + D);
+            }
+            else {
+                knock_in = down
+                    ? (strike_above ? B - C + D : A)
+                    : (strike_above ? A - B + D : C);
+            }
+
+            return knock_out ? vanilla_price - knock_in : knock_in;
+        }
+
+    public:
+        explicit BarrierModel(const BarrierCreateInfo<T>& info)
+            : info_(info)
+        {
+            info.validate();
+        }
+
+        T call_price() const {
+            return price(static_cast<T>(1));
+        }
+
+        T put_price() const {
+            return price(static_cast<T>(-1));
+        }
+    };
+
+} // namespace ito::model
@@ -1,5 +1,6 @@
 ﻿#pragma once
 #include <ito/utils/math.hpp>
+#include <ito/utils/vmath.hpp>
 #include <cmath>
 #include <stdexcept>
 
@@ -62,10 +63,11 @@ namespace ito::model {
             // d1 = [ln(S/K) + (r + sigma^2/2)*T] / (sigma * sqrt(T))
             // d2 = d1 - sigma * sqrt(T)
             if (d_cached_) return;
-            const T sqrt_T = std::sqrt(T_);
+            using std::sqrt;
+            const T sqrt_T = sqrt(T_);
             const T sigma_sqrt_T = sigma_ * sqrt_T;
 
-            d1_ = (std::log(S_ / K_) + (r_ + sigma_ * sigma_ / static_cast<T>(2)) * T_) 
+            d1_ = (math::poly_log(S_ / K_) + (r_ + sigma_ * sigma_ / static_cast<T>(2)) * T_) 
                 / sigma_sqrt_T;
             d2_ = d1_ - sigma_sqrt_T;
 
@@ -79,8 +81,9 @@ namespace ito::model {
             // reused
             auto Phi = math::normal_cdf<T>;
             auto phi = math::normal_pdf<T>;
-            const T sqrt_T = std::sqrt(T_);
-            const T exp_neg_rT = std::exp(-r_ * T_);
+            using std::sqrt, std::exp;
+            const T sqrt_T = sqrt(T_);
+            const T exp_neg_rT = exp(-r_ * T_);
             const T phi_d1 = phi(d1_);
 
             // delta = Phi(d1)
@@ -105,8 +108,9 @@ namespace ito::model {
             // reused
             auto Phi = math::normal_cdf<T>;
             auto phi = math::normal_pdf<T>;
-            const T sqrt_T = std::sqrt(T_);
-            const T exp_neg_rT = std::exp(-r_ * T_);
+            using std::sqrt, std::exp;
+            const T sqrt_T = sqrt(T_);
+            const T exp_neg_rT = exp(-r_ * T_);
             const T phi_d1 = phi(d1_);
 
             //delta = Phi(d1) - 1 [or -Phi(-d1)]
@@ -144,7 +148,8 @@ namespace ito::model {
             compute_d();
             // C = S*Phi(d1_) - Ke^(-rT)*Phi(d2)
             auto Phi = ito::math::normal_cdf<T>;
-            T C = S_ * Phi(d1_) - K_ * std::exp(-r_ * T_) * Phi(d2_);
+            using std::exp;
+            T C = S_ * Phi(d1_) - K_ * exp(-r_ * T_) * Phi(d2_);
             return C;
         }
 
@@ -159,7 +164,8 @@ namespace ito::model {
             
             // Put-call arity (simpler to code):
             // P = C - S + K*e^(-rT)
-            T P = call_price() - S_ + K_ * std::exp(-r_ * T_);
+            using std::exp;
+            T P = call_price() - S_ + K_ * exp(-r_ * T_);
             return P;
         }
 
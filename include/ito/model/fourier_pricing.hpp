@@ -0,0 +1,45 @@
+#pragma once
+#include <ito/utils/math.hpp>
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <cstddef>
+#include <numbers>
+
+namespace ito::model {
+
+    /**
+     * European call from a characteristic function (Lewis, 2001)
+     *     C = S - √(S K) e^(-rT/2) / π ∫_0^∞ Re[e^(iuk) φ(u - i/2)] / (u² + 1/4) du
+     * with k = ln(S/K) + rT and φ(u) = E[exp(iu ln(S_T / F))], F = S e^(rT),
+     * evaluated at complex u. The integral runs by composite Simpson on
+     * [0, u_max]; mean_variance (per year) sets u_max, since the integrand
+     * decays like exp(-mean_variance T u² / 2).
+     */
+    template<math::Arithmetic T, typename CharacteristicFunction>
+    T lewis_call_price(T S, T K, T r, T time, T mean_variance, CharacteristicFunction&& phi) {
+        const T k = std::log(S / K) + r * time;
+
+        // Step 1 - Truncation and an even number of Simpson panels of width <= 0.1
+        const T u_max = std::clamp(
+            std::sqrt(static_cast<T>(80) / (std::max(mean_variance, static_cast<T>(1e-8)) * time)),
+            static_cast<T>(50), static_cast<T>(2000));
+        const size_t panels = 2 * static_cast<size_t>(std::ceil(u_max / static_cast<T>(0.2)));
+        const T h = u_max / static_cast<T>(panels);
+
+        // Step 2 - Simpson weights 1, 4, 2, 4, ..., 4, 1
+        const std::complex<T> half_i(T{}, static_cast<T>(0.5));
+        auto f = [&](T u) {
+            const std::complex<T> phase(T{}, u * k);
+            return std::real(std::exp(phase) * phi(std::complex<T>(u) - half_i)) / (u * u + static_cast<T>(0.25));
+        };
+        T sum = f(T{}) + f(u_max);
+        for (size_t j = 1; j < panels; ++j) {
+            sum += (j % 2 == 1 ? static_cast<T>(4) : static_cast<T>(2)) * f(static_cast<T>(j) * h);
+        }
+        const T integral = sum * h / static_cast<T>(3);
+
+        return S - std::sqrt(S * K) * std::exp(-r * time / static_cast<T>(2)) * integral * std::numbers::inv_pi_v<T>;
+    }
+
+} // namespace ito::model
@@ -0,0 +1,100 @@
+#pragma once
+#include <ito/utils/math.hpp>
+#include <ito/model/fourier_pricing.hpp>
+#include <cmath>
+#include <complex>
+#include <stdexcept>
+
+namespace ito::model {
+
+    template<math::Arithmetic T = double>
+    struct HestonCreateInfo {
+        T spot_price;           // S - current price of underlying
+        T strike_price;         // K - strike/exercise price
+        T risk_free_rate;       // r - risk-free interest rate (annualized)
+        T initial_variance;     // v0 - instantaneous variance at t = 0
+        T long_run_variance;    // θ (theta) - mean-reversion level of the variance
+        T mean_reversion;       // κ (kappa) - speed of mean reversion
+        T vol_of_vol;           // ξ (xi) - volatility of the variance
+        T correlation;          // ρ (rho) - correlation of price and variance shocks
+        T time_to_maturity;     // T - time to expiration (in years)
+
+        constexpr void validate() const {
+            if (spot_price <= 0)
+                throw std::invalid_argument("Spot price must be positive");
+            if (strike_price <= 0)
+                throw std::invalid_argument("Strike price must be positive");
+            if (initial_variance < 0 || long_run_variance < 0)
+                throw std::invalid_argument("Variances cannot be negative");
+            if (mean_reversion <= 0)
+                throw std::invalid_argument("Mean reversion must be positive");
+            if (vol_of_vol <= 0)
+                throw std::invalid_argument("Vol of vol must be positive");
+            if (!(correlation >= -1 && correlation <= 1))
+                throw std::invalid_argument("Correlation must lie in [-1, 1]");
+            if (time_to_maturity <= 0)
+                throw std::invalid_argument("Time to maturity must be positive");
+        }
+    };
+
+    /**
+     * Heston (1993) stochastic-volatility model
+     *     dS = r S dt + √v S dW_S
+     *     dv = κ (θ - v) dt + ξ √v dW_v,   d<W_S, W_v> = ρ dt
+     * European prices by Fourier inversion (lewis_call_price) of the
+     * characteristic function of ln(S_T / F), in the "little trap" form of
+     * Albrecher et al. (2007), which stays on the principal branch of the
+     * complex log for long maturities.
+     */
+    template<math::Arithmetic T = double>
+    class HestonModel {
+    private:
+        HestonCreateInfo<T> info_;
+
+    public:
+        explicit HestonModel(const HestonCreateInfo<T>& info)
+            : info_(info)
+        {
+            info.validate();
+        }
+
+        // E[exp(iu ln(S_T / F))], F = S e^(rT); u may be complex
+        std::complex<T> characteristic_function(std::complex<T> u) const {
+            using C = std::complex<T>;
+            const C i(T{}, static_cast<T>(1));
+            const T kappa = info_.mean_reversion;
+            const T theta = info_.long_run_variance;
+            const T xi = info_.vol_of_vol;
+            const T rho = info_.correlation;
+            const T time = info_.time_to_maturity;
+
+            const C beta = kappa - rho * xi * i * u;
+            const C d = std::sqrt(beta * beta + xi * xi * (i * u + u * u));
+            const C g = (beta - d) / (beta + d);
+            const C e = std::exp(-d * time);
+
+            const C A = kappa * theta / (xi * xi)
+                * ((beta - d) * time - static_cast<T>(2) * std::log((static_cast<T>(1) - g * e) / (static_cast<T>(1) - g)));
+            const C B = (beta - d) / (xi * xi) * (static_cast<T>(1) - e) / (static_cast<T>(1) - g * e);
+            return std::exp(A + B * info_.initial_variance);
+        }
+
+        T call_price() const {
+            // Truncation from the mean expected variance over [0, T]
+            const T kappa_T = info_.mean_reversion * info_.time_to_maturity;
+            const T mean_variance = info_.long_run_variance
+                + (info_.initial_variance - info_.long_run_variance) * (static_cast<T>(1) - std::exp(-kappa_T)) / kappa_T;
+
+            return lewis_call_price(info_.spot_price, info_.strike_price, info_.risk_free_rate,
+                info_.time_to_maturity, mean_variance,
+                [this](std::complex<T> u) { return characteristic_function(u); });
+        }
+
+        // Put-call parity: P = C - S + K e^(-rT)
+        T put_price() const {
+            return call_price() - info_.spot_price
+                + info_.strike_price * std::exp(-info_.risk_free_rate * info_.time_to_maturity);
+        }
+    };
+
+} // namespace ito::model
@@ -0,0 +1,286 @@
+#pragma once
+#include <ito/utils/math.hpp>
+#include <ito/model/fourier_pricing.hpp>
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <cstddef>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+namespace ito::model {
+
+    // Lognormal jumps (Merton, 1976): log jump size Y ~ N(μ_J, δ²)
+    template<math::Arithmetic T = double>
+    struct MertonJumps {
+        T mean;         // μ_J - mean of the log jump size
+        T volatility;   // δ (delta) - standard deviation of the log jump size
+
+        constexpr void validate() const {
+            if (volatility < 0)
+                throw std::invalid_argument("Jump volatility cannot be negative");
+        }
+
+        // κ = E[e^Y] - 1, the expected relative jump
+        T compensator() const {
+            return std::exp(mean + volatility * volatility / static_cast<T>(2)) - static_cast<T>(1);
+        }
+
+        // Y from one uniform in (0, 1)
+        T sample(T u) const noexcept {
+            return mean + volatility * math::inverse_normal_cdf(u);
+        }
+
+        // E[exp(iuY)]
+        std::complex<T> characteristic_function(std::complex<T> u) const {
+            const std::complex<T> i(T{}, static_cast<T>(1));
+            return std::exp(i * u * mean - volatility * volatility * u * u / static_cast<T>(2));
+        }
+    };
+
+    // Double-exponential jumps (Kou, 2002): Y ~ Exp(η1) w.p. p, -Exp(η2) otherwise
+    template<math::Arithmetic T = double>
+    struct KouJumps {
+        T up_probability;  // p - probability of an upward jump
+        T up_rate;         // η1 (eta1) - rate of upward jumps, > 1 so E[e^Y] is finite
+        T down_rate;       // η2 (eta2) - rate of downward jumps
+
+        constexpr void validate() const {
+            if (!(up_probability >= 0 && up_probability <= 1))
+                throw std::invalid_argument("Up-jump probability must lie in [0, 1]");
+            if (!(up_rate > 1))
+                throw std::invalid_argument("Up-jump rate must exceed 1");
+            if (!(down_rate > 0))
+                throw std::invalid_argument("Down-jump rate must be positive");
+        }
+
+        // κ = E[e^Y] - 1 = p η1 / (η1 - 1) + (1 - p) η2 / (η2 + 1) - 1
+        T compensator() const noexcept {
+            return up_probability * up_rate / (up_rate - static_cast<T>(1))
+                + (static_cast<T>(1) - up_probability) * down_rate / (down_rate + static_cast<T>(1))
+                - static_cast<T>(1);
+        }
+
+        // Y from one uniform: u < p picks the upper tail, rescaled to (0, 1)
+        T sample(T u) const noexcept {
+            if (u < up_probability) {
+                return -std::log(u / up_probability) / up_rate;
+            }
+            return std::log((u - up_probability) / (static_cast<T>(1) - up_probability)) / down_rate;
+        }
+
+        // E[exp(iuY)] = p η1 / (η1 - iu) + (1 - p) η2 / (η2 + iu)
+        std::complex<T> characteristic_function(std::complex<T> u) const {
+            const std::complex<T> iu = std::complex<T>(T{}, static_cast<T>(1)) * u;
+            return up_probability * up_rate / (up_rate - iu)
+                + (static_cast<T>(1) - up_probability) * down_rate / (down_rate + iu);
+        }
+    };
+
+    template<math::Arithmetic T = double, typename Jumps = MertonJumps<T>>
+    struct JumpDiffusionCreateInfo {
+        T spot_price;           // S - current price of underlying
+        T strike_price;         // K - strike/exercise price
+        T risk_free_rate;       // r - risk-free interest rate (annualized)
+        T volatility;           // σ (sigma) - diffusion volatility (annualized)
+        T jump_intensity;       // λ (lambda) - expected jumps per year
+        Jumps jumps;            // law of the log jump size Y
+        T time_to_maturity;     // T - time to expiration (in years)
+
+        constexpr void validate() const {
+            if (spot_price <= 0)
+                throw std::invalid_argument("Spot price must be positive");
+            if (strike_price <= 0)
+                throw std::invalid_argument("Strike price must be positive");
+            if (volatility < 0)
+                throw std::invalid_argument("Volatility cannot be negative");
+            if (jump_intensity < 0)
+                throw std::invalid_argument("Jump intensity cannot be negative");
+            if (time_to_maturity <= 0)
+                throw std::invalid_argument("Time to maturity must be positive");
+            jumps.validate();
+        }
+    };
+
+    template<math::Arithmetic T = double>
+    using MertonCreateInfo = JumpDiffusionCreateInfo<T, MertonJumps<T>>;
+
+    template<math::Arithmetic T = double>
+    using KouCreateInfo = JumpDiffusionCreateInfo<T, KouJumps<T>>;
+
+    // E[exp(iu ln(S_T / F))] of a compensated jump diffusion:
+    // exp(T [-σ²/2 (iu + u²) + λ (φ_Y(u) - 1) - iu λ κ])
+    template<math::Arithmetic T, typename Jumps>
+    std::complex<T> jump_diffusion_characteristic_function(
+        const JumpDiffusionCreateInfo<T, Jumps>& info,
+        std::complex<T> u
+    ) {
+        const std::complex<T> iu = std::complex<T>(T{}, static_cast<T>(1)) * u;
+        const T sigma2 = info.volatility * info.volatility;
+        const T lambda = info.jump_intensity;
+        const std::complex<T> exponent = -sigma2 / static_cast<T>(2) * (iu + u * u)
+            + lambda * (info.jumps.characteristic_function(u) - static_cast<T>(1))
+            - iu * lambda * info.jumps.compensator();
+        return std::exp(info.time_to_maturity * exponent);
+    }
+
+    /**
+     * Merton (1976) jump diffusion, closed form as a Poisson mixture of
+     * Black-Scholes prices:
+     *     C = Σ_n e^(-λ'T) (λ'T)^n / n! * BS(S, K, r_n, σ_n, T)
+     *     λ' = λ (1 + κ),  σ_n² = σ² + n δ² / T,  r_n = r - λ κ + n ln(1 + κ) / T
+     * Each BS term is at most S, so the series stops once the Poisson mass
+     * left is below `tolerance` (relative to S) - a handful of terms for
+     * short-dated options.
+     *
+     * call_prices() revalues a whole chain in one sweep: the term loop is
+     * outside, options inside (structure-of-arrays), and each option drops
+     * out as soon as its own series has converged.
+     */
+    template<math::Arithmetic T = double>
+    class MertonModel {
+    public:
+        // Series stop: Poisson mass left, relative to S
+        static constexpr T default_tolerance = static_cast<T>(1e-12);
+
+        // Hard cap on the number of Poisson terms
+        static constexpr size_t max_terms = 1000;
+
+        explicit MertonModel(const MertonCreateInfo<T>& info, T tolerance = default_tolerance)
+            : info_(info), tolerance_(tolerance)
+        {
+            info.validate();
+        }
+
+        std::complex<T> characteristic_function(std::complex<T> u) const {
+            return jump_diffusion_characteristic_function(info_, u);
+        }
+
+        T call_price() const {
+            const T K = info_.strike_price;
+            const T time = info_.time_to_maturity;
+            T call;
+            call_prices(std::span<const T>(&K, 1), std::span<const T>(&time, 1), std::span<T>(&call, 1));
+            return call;
+        }
+
+        // Put-call parity: P = C - S + K e^(-rT)
+        T put_price() const {
+            return call_price() - info_.spot_price
+                + info_.strike_price * std::exp(-info_.risk_free_rate * info_.time_to_maturity);
+        }
+
+        // Batch calls and puts; puts by parity
+        void calls_and_puts(std::span<const T> strikes, std::span<const T> maturities, std::span<T> calls, std::span<T> puts) const {
+            call_prices(strikes, maturities, calls);
+            for (size_t i{}; i < strikes.size(); ++i) {
+                puts[i] = calls[i] - info_.spot_price + strikes[i] * std::exp(-info_.risk_free_rate * maturities[i]);
+            }
+        }
+
+        /**
+         * Batch revaluation: calls[i] for strikes[i] and maturities[i], with the
+         * spot, rate and jump parameters of this model
+         */
+        void call_prices(std::span<const T> strikes, std::span<const T> maturities, std::span<T> calls) const {
+            const size_t count = strikes.size();
+            if (maturities.size() != count || calls.size() < count)
+                throw std::invalid_argument("Strikes, maturities and prices must have the same length");
+
+            const T S = info_.spot_price;
+            const T sigma2 = info_.volatility * info_.volatility;
+            const T delta2 = info_.jumps.volatility * info_.jumps.volatility;
+            const T kappa = info_.jumps.compensator();
+            const T lambda_prime = info_.jump_intensity * (static_cast<T>(1) + kappa);
+            const T log_one_plus_kappa = info_.jumps.mean + delta2 / static_cast<T>(2);  // ln(1 + κ)
+            const T base_rate = info_.risk_free_rate - info_.jump_intensity * kappa;
+
+            // Step 1 - Per-option Poisson weight e^(-λ'T), accumulated mass and state
+            std::vector<T> weight(count);
+            std::vector<T> mass(count, T{});
+            std::vector<char> active(count, 1);
+            for (size_t i{}; i < count; ++i) {
+                if (!(strikes[i] > 0) || !(maturities[i] > 0))
+                    throw std::invalid_argument("Strikes and maturities must be positive");
+                weight[i] = std::exp(-lambda_prime * maturities[i]);
+                calls[i] = T{};
+            }
+
+            // Step 2 - Term n for every option still converging
+            auto Phi = ito::math::normal_cdf<T>;
+            size_t remaining = count;
+            for (size_t n{}; n < max_terms && remaining > 0; ++n) {
+                const T nT = static_cast<T>(n);
+                for (size_t i{}; i < count; ++i) {
+                    if (!active[i]) continue;
+
+                    const T time = maturities[i];
+                    const T K = strikes[i];
+                    const T variance = sigma2 * time + nT * delta2;   // σ_n² T
+                    const T r_n_T = base_rate * time + nT * log_one_plus_kappa;
+
+                    T term;
+                    if (variance > 0) {
+                        const T sqrt_v = std::sqrt(variance);
+                        const T d1 = (std::log(S / K) + r_n_T + variance / static_cast<T>(2)) / sqrt_v;
+                        term = S * Phi(d1) - K * std::exp(-r_n_T) * Phi(d1 - sqrt_v);
+                    }
+                    else {
+                        term = std::max(S - K * std::exp(-r_n_T), T{});
+                    }
+                    calls[i] += weight[i] * term;
+                    mass[i] += weight[i];
+
+                    // Past the Poisson mode, stop once the mass left is negligible
+                    // (or the weights have underflowed)
+                    const T mean_jumps = lambda_prime * time;
+                    if (nT >= mean_jumps && (static_cast<T>(1) - mass[i] < tolerance_ || weight[i] == T{})) {
+                        active[i] = 0;
+                        --remaining;
+                    }
+                    weight[i] *= mean_jumps / (nT + static_cast<T>(1));
+                }
+            }
+        }
+
+    private:
+        MertonCreateInfo<T> info_;
+        T tolerance_;
+    };
+
+    /**
+     * Kou (2002) double-exponential jump diffusion
+     * European prices by Fourier inversion (lewis_call_price) of the
+     * characteristic function; u_max is set by the diffusion variance σ².
+     */
+    template<math::Arithmetic T = double>
+    class KouModel {
+    public:
+        explicit KouModel(const KouCreateInfo<T>& info)
+            : info_(info)
+        {
+            info.validate();
+        }
+
+        std::complex<T> characteristic_function(std::complex<T> u) const {
+            return jump_diffusion_characteristic_function(info_, u);
+        }
+
+        T call_price() const {
+            return lewis_call_price(info_.spot_price, info_.strike_price, info_.risk_free_rate,
+                info_.time_to_maturity, info_.volatility * info_.volatility,
+                [this](std::complex<T> u) { return characteristic_function(u); });
+        }
+
+        // Put-call parity: P = C - S + K e^(-rT)
+        T put_price() const {
+            return call_price() - info_.spot_price
+                + info_.strike_price * std::exp(-info_.risk_free_rate * info_.time_to_maturity);
+        }
+
+    private:
+        KouCreateInfo<T> info_;
+    };
+
+} // namespace ito::model
@@ -0,0 +1,257 @@
+#pragma once
+#include <ito/utils/math.hpp>
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+namespace ito::model {
+
+    template<math::Arithmetic T = double>
+    struct LocalVolCreateInfo {
+        T spot_price;                 // S0 - current price of underlying
+        T risk_free_rate;             // r - risk-free interest rate (annualized)
+        std::vector<T> maturities;    // implied-vol expiries t_1 < ... < t_m (years)
+        std::vector<T> strikes;       // implied-vol strikes K_1 < ... < K_k
+        std::vector<T> implied_vols;  // σ_imp(t_i, K_j), maturity-major (m x k)
+        size_t num_times = 101;       // local-vol grid rows on [0, t_m]
+        size_t num_log_spots = 201;   // local-vol grid columns in ln S
+        T num_std_devs = 5;           // ln S range: ln S0 ± num_std_devs * max σ_imp * √t_m
+
+        void validate() const {
+            if (spot_price <= 0)
+                throw std::invalid_argument("Spot price must be positive");
+            if (maturities.empty() || strikes.size() < 2)
+                throw std::invalid_argument("Implied-vol grid needs at least one maturity and two strikes");
+            if (implied_vols.size() != maturities.size() * strikes.size())
+                throw std::invalid_argument("Implied vols must be a maturities x strikes grid");
+            for (size_t i{}; i < maturities.size(); ++i) {
+                if (!(maturities[i] > (i == 0 ? T{} : maturities[i - 1])))
+                    throw std::invalid_argument("Maturities must be positive and strictly increasing");
+            }
+            for (size_t j{}; j < strikes.size(); ++j) {
+                if (!(strikes[j] > (j == 0 ? T{} : strikes[j - 1])))
+                    throw std::invalid_argument("Strikes must be positive and strictly increasing");
+            }
+            for (T vol : implied_vols) {
+                if (!(vol > 0))
+                    throw std::invalid_argument("Implied volatilities must be positive");
+            }
+            if (num_times < 2 || num_log_spots < 2)
+                throw std::invalid_argument("Local-vol grid needs at least 2 x 2 nodes");
+            if (!(num_std_devs > 0))
+                throw std::invalid_argument("Log-spot range must be positive");
+        }
+    };
+
+    /**
+     * Dupire local-volatility surface, precomputed on a regular (t, ln S) grid
+     * Implied vols are splined (natural cubic) in log-moneyness y = ln(K/F) per
+     * expiry and interpolated linearly in total variance w = σ² t across
+     * expiries (flat vol outside the grid). Local variance at each node is
+     * Gatheral's form of Dupire's equation in w(t, y):
+     *     σ_loc² = ∂w/∂t / [1 - y/w ∂w/∂y + 1/4 (-1/4 - 1/w + y²/w²) (∂w/∂y)² + 1/2 ∂²w/∂y²]
+     * by central differences, clamped to [min_volatility, max_volatility]
+     * (arbitrageable inputs fall back to the implied variance).
+     *
+     * Lookups are bilinear and branch-free (clamped indices, no tests on the
+     * data). slice(t) interpolates one row in time, so path engines pay the
+     * time interpolation once per step and a 1D lookup per path into a row
+     * of num_log_spots values that stays in L1.
+     */
+    template<math::Arithmetic T = double>
+    class LocalVolSurface {
+    public:
+        // Clamp of the local volatility
+        static constexpr T min_volatility = static_cast<T>(0.01);
+        static constexpr T max_volatility = static_cast<T>(3);
+
+        explicit LocalVolSurface(const LocalVolCreateInfo<T>& info)
+            : S0_(info.spot_price)
+            , r_(info.risk_free_rate)
+            , maturities_(info.maturities)
+            , num_times_(info.num_times)
+            , num_log_spots_(info.num_log_spots)
+        {
+            info.validate();
+            fit_smiles(info);
+
+            // Step 1 - Regular grid: t in [0, t_m], ln S centred on ln S0
+            const T t_max = maturities_.back();
+            const T vol_max = *std::max_element(info.implied_vols.begin(), info.implied_vols.end());
+            const T half_width = info.num_std_devs * vol_max * std::sqrt(t_max);
+            dt_ = t_max / static_cast<T>(num_times_ - 1);
+            dx_ = static_cast<T>(2) * half_width / static_cast<T>(num_log_spots_ - 1);
+            x_min_ = std::log(S0_) - half_width;
+            inv_dt_ = static_cast<T>(1) / dt_;
+            inv_dx_ = static_cast<T>(1) / dx_;
+
+            // Step 2 - Dupire at every node; differences at the grid scale
+            const T h_t = std::min(dt_, maturities_.front()) / static_cast<T>(2);
+            const T h_y = dx_;
+            sigma_.resize(num_times_ * num_log_spots_);
+            for (size_t i{}; i < num_times_; ++i) {
+                const T t = std::max(static_cast<T>(i) * dt_, h_t);  // t = 0 row uses the first differences
+                for (size_t j{}; j < num_log_spots_; ++j) {
+                    const T y = x_min_ + static_cast<T>(j) * dx_ - std::log(S0_) - r_ * t;
+
+                    const T w = total_variance(t, y);
+                    const T w_t = (total_variance(t + h_t, y) - total_variance(t - h_t, y)) / (static_cast<T>(2) * h_t);
+                    const T w_up = total_variance(t, y + h_y);
+                    const T w_down = total_variance(t, y - h_y);
+                    const T w_y = (w_up - w_down) / (static_cast<T>(2) * h_y);
+                    const T w_yy = (w_up - static_cast<T>(2) * w + w_down) / (h_y * h_y);
+
+                    const T denominator = static_cast<T>(1) - y / w * w_y
+                        + static_cast<T>(0.25) * (static_cast<T>(-0.25) - static_cast<T>(1) / w + y * y / (w * w)) * w_y * w_y
+                        + static_cast<T>(0.5) * w_yy;
+                    T variance = w_t / denominator;
+                    if (!(denominator > 0) || !(variance > 0)) {
+                        variance = w / t;
+                    }
+                    sigma_[i * num_log_spots_ + j] = std::clamp(std::sqrt(variance), min_volatility, max_volatility);
+                }
+            }
+        }
+
+        T spot_price() const noexcept { return S0_; }
+        T risk_free_rate() const noexcept { return r_; }
+        T max_time() const noexcept { return maturities_.back(); }
+        size_t num_times() const noexcept { return num_times_; }
+        size_t num_log_spots() const noexcept { return num_log_spots_; }
+        T log_spot_min() const noexcept { return x_min_; }
+        T log_spot_step() const noexcept { return dx_; }
+
+        // σ_loc at grid node (time row i, log-spot column j)
+        std::span<const T> values() const noexcept { return sigma_; }
+
+        // Interpolated implied total variance w(t, y), y = ln(K / F(t))
+        T total_variance(T t, T y) const {
+            // Flat vol before the first and after the last expiry
+            if (t <= maturities_.front()) return t * smile(0, y) * smile(0, y);
+            const size_t m = maturities_.size();
+            if (t >= maturities_.back()) return t * smile(m - 1, y) * smile(m - 1, y);
+
+            const size_t i = static_cast<size_t>(std::upper_bound(maturities_.begin(), maturities_.end(), t) - maturities_.begin());
+            const T t0 = maturities_[i - 1];
+            const T t1 = maturities_[i];
+            const T w0 = t0 * smile(i - 1, y) * smile(i - 1, y);
+            const T w1 = t1 * smile(i, y) * smile(i, y);
+            return w0 + (w1 - w0) * (t - t0) / (t1 - t0);
+        }
+
+        // Bilinear σ_loc(t, ln S), clamped to the grid
+        T local_volatility(T t, T log_spot) const noexcept {
+            const auto [i, a] = locate(t, T{}, inv_dt_, num_times_);
+            const auto [j, b] = locate(log_spot, x_min_, inv_dx_, num_log_spots_);
+            const T* row0 = sigma_.data() + i * num_log_spots_;
+            const T* row1 = row0 + num_log_spots_;
+            const T lo = row0[j] + b * (row0[j + 1] - row0[j]);
+            const T hi = row1[j] + b * (row1[j + 1] - row1[j]);
+            return lo + a * (hi - lo);
+        }
+
+        // Row of σ_loc at time t (num_log_spots values), linear in time
+        void slice(T t, std::span<T> out) const noexcept {
+            const auto [i, a] = locate(t, T{}, inv_dt_, num_times_);
+            const T* row0 = sigma_.data() + i * num_log_spots_;
+            const T* row1 = row0 + num_log_spots_;
+            for (size_t j{}; j < num_log_spots_; ++j) {
+                out[j] = row0[j] + a * (row1[j] - row0[j]);
+            }
+        }
+
+        // Linear lookup of ln S values in a slice: sigma[k] = slice(x[k])
+        void lookup(std::span<const T> slice, std::span<const T> x, std::span<T> sigma) const noexcept {
+            const T last = static_cast<T>(num_log_spots_ - 1);
+            for (size_t k{}; k < x.size(); ++k) {
+                const T f = std::min(std::max((x[k] - x_min_) * inv_dx_, T{}), last);
+                const size_t j = std::min(static_cast<size_t>(f), num_log_spots_ - 2);
+                const T b = f - static_cast<T>(j);
+                sigma[k] = slice[j] + b * (slice[j + 1] - slice[j]);
+            }
+        }
+
+    private:
+        struct Location {
+            size_t index;   // left node, <= n - 2
+            T weight;       // in [0, 1]
+        };
+
+        // Clamped cell and weight of `value` on a regular grid of n nodes
+        static Location locate(T value, T origin, T inv_step, size_t n) noexcept {
+            const T f = std::min(std::max((value - origin) * inv_step, T{}), static_cast<T>(n - 1));
+            const size_t index = std::min(static_cast<size_t>(f), n - 2);
+            return { index, f - static_cast<T>(index) };
+        }
+
+        // Natural cubic spline of the implied vol in y, per expiry
+        void fit_smiles(const LocalVolCreateInfo<T>& info) {
+            const size_t m = maturities_.size();
+            const size_t k = info.strikes.size();
+            y_.resize(m * k);
+            vol_.assign(info.implied_vols.begin(), info.implied_vols.end());
+            curvature_.assign(m * k, T{});
+
+            std::vector<T> c(k);
+            std::vector<T> d(k);
+            for (size_t i{}; i < m; ++i) {
+                const T forward = S0_ * std::exp(r_ * maturities_[i]);
+                T* y = y_.data() + i * k;
+                const T* v = vol_.data() + i * k;
+                T* M = curvature_.data() + i * k;
+                for (size_t j{}; j < k; ++j) y[j] = std::log(info.strikes[j] / forward);
+
+                // Thomas algorithm on the interior second derivatives (M_0 = M_k-1 = 0)
+                for (size_t j = 1; j + 1 < k; ++j) {
+                    const T h0 = y[j] - y[j - 1];
+                    const T h1 = y[j + 1] - y[j];
+                    const T diag = static_cast<T>(2) * (h0 + h1) - (j > 1 ? h0 * c[j - 1] : T{});
+                    c[j] = h1 / diag;
+                    const T rhs = static_cast<T>(6) * ((v[j + 1] - v[j]) / h1 - (v[j] - v[j - 1]) / h0);
+                    d[j] = (rhs - (j > 1 ? h0 * d[j - 1] : T{})) / diag;
+                }
+                for (size_t j = k - 1; j-- > 1;) {
+                    M[j] = d[j] - c[j] * M[j + 1];
+                }
+            }
+        }
+
+        // Implied vol of expiry i at y; flat beyond the outer strikes
+        T smile(size_t i, T y) const {
+            const size_t k = num_strikes();
+            const T* ys = y_.data() + i * k;
+            const T* v = vol_.data() + i * k;
+            const T* M = curvature_.data() + i * k;
+            if (y <= ys[0]) return v[0];
+            if (y >= ys[k - 1]) return v[k - 1];
+
+            const size_t j = static_cast<size_t>(std::upper_bound(ys, ys + k, y) - ys) - 1;
+            const T h = ys[j + 1] - ys[j];
+            const T a = (ys[j + 1] - y) / h;
+            const T b = (y - ys[j]) / h;
+            return a * v[j] + b * v[j + 1] + ((a * a * a - a) * M[j] + (b * b * b - b) * M[j + 1]) * h * h / static_cast<T>(6);
+        }
+
+        size_t num_strikes() const noexcept { return y_.size() / maturities_.size(); }
+
+        T S0_;
+        T r_;
+        std::vector<T> maturities_;
+        std::vector<T> y_;          // log-moneyness nodes per expiry
+        std::vector<T> vol_;        // implied vols per expiry
+        std::vector<T> curvature_;  // spline second derivatives per expiry
+
+        size_t num_times_;
+        size_t num_log_spots_;
+        T dt_{};
+        T dx_{};
+        T inv_dt_{};
+        T inv_dx_{};
+        T x_min_{};
+        std::vector<T> sigma_;      // σ_loc, time-major (num_times x num_log_spots)
+    };
+
+} // namespace ito::model
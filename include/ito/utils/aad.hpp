@@ -0,0 +1,300 @@
+#pragma once
+#include <ito/utils/math.hpp>
+#include <array>
+#include <cmath>
+#include <compare>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <numbers>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace ito::math {
+
+    template<Scalar T>
+    class Tape;
+
+    /**
+     * Reverse-mode (adjoint) active number
+     * Every operation on a Var that depends on an input appends one node to
+     * the calling thread's active Tape, holding the local partial derivatives
+     * of the result; constants (index 0) record nothing. One backward sweep of
+     * the tape (Tape::propagate) then gives the derivative of an output with
+     * respect to EVERY input at a small constant multiple of the cost of the
+     * calculation, however many inputs there are.
+     *
+     *     Tape<double> tape;
+     *     Tape<double>::Scope scope(tape);
+     *     const Var<double> S = tape.variable(100.0), sigma = tape.variable(0.2);
+     *     BlackScholesModel<Var<double>> model({ .spot_price = S, ..., .volatility = sigma, ... });
+     *     const Var<double> C = model.call_price();
+     *     tape.seed(C);
+     *     tape.propagate();   // tape.adjoint(S) = delta, tape.adjoint(sigma) = vega
+     *
+     * Comparisons look at the value only, as for Dual.
+     */
+    template<Scalar T = double>
+    struct Var {
+        using value_type = T;
+
+        T value{};
+        std::uint32_t index = 0;  // tape node of the value; 0 = constant
+
+        constexpr Var() = default;
+
+        // Constants: not on the tape
+        constexpr Var(T v) noexcept : value(v) {}
+
+        template<Scalar U>
+        constexpr Var(U v) noexcept : value(static_cast<T>(v)) {}
+
+        constexpr Var(T v, std::uint32_t node) noexcept : value(v), index(node) {}
+
+        constexpr bool is_constant() const noexcept { return index == 0; }
+
+        /**
+         * f(x) from its value f and derivative df at x.value: one tape node
+         * Building block of every operation below; also the way to lift a
+         * scalar routine with a known derivative onto Var.
+         */
+        friend constexpr Var chain(const Var& x, T f, T df) {
+            if (x.index == 0) return Var(f);
+            return Var(f, Tape<T>::active().record(x.index, df, 0, T{}));
+        }
+
+        // f(a, b) from its value and partials ∂f/∂a, ∂f/∂b
+        friend constexpr Var chain(const Var& a, const Var& b, T f, T da, T db) {
+            if (a.index == 0 && b.index == 0) return Var(f);
+            return Var(f, Tape<T>::active().record(a.index, da, b.index, db));
+        }
+
+        // Step 1 - Arithmetic
+        constexpr Var operator+() const noexcept { return *this; }
+        constexpr Var operator-() const { return chain(*this, -value, static_cast<T>(-1)); }
+
+        friend constexpr Var operator+(const Var& a, const Var& b) {
+            return chain(a, b, a.value + b.value, static_cast<T>(1), static_cast<T>(1));
+        }
+
+        friend constexpr Var operator-(const Var& a, const Var& b) {
+            return chain(a, b, a.value - b.value, static_cast<T>(1), static_cast<T>(-1));
+        }
+
+        friend constexpr Var operator*(const Var& a, const Var& b) {
+            return chain(a, b, a.value * b.value, b.value, a.value);
+        }
+
+        friend constexpr Var operator/(const Var& a, const Var& b) {
+            const T inv = static_cast<T>(1) / b.value;
+            const T q = a.value * inv;
+            return chain(a, b, q, inv, -q * inv);
+        }
+
+        // Scalars: one-parent nodes
+        template<Scalar U> friend constexpr Var operator+(const Var& a, U b) { return chain(a, a.value + static_cast<T>(b), static_cast<T>(1)); }
+        template<Scalar U> friend constexpr Var operator-(const Var& a, U b) { return chain(a, a.value - static_cast<T>(b), static_cast<T>(1)); }
+        template<Scalar U> friend constexpr Var operator*(const Var& a, U b) { return chain(a, a.value * static_cast<T>(b), static_cast<T>(b)); }
+        template<Scalar U> friend constexpr Var operator/(const Var& a, U b) { return a * (static_cast<T>(1) / static_cast<T>(b)); }
+
+        template<Scalar U> friend constexpr Var operator+(U a, const Var& b) { return b + a; }
+        template<Scalar U> friend constexpr Var operator-(U a, const Var& b) { return chain(b, static_cast<T>(a) - b.value, static_cast<T>(-1)); }
+        template<Scalar U> friend constexpr Var operator*(U a, const Var& b) { return b * a; }
+
+        template<Scalar U>
+        friend constexpr Var operator/(U a, const Var& b) {
+            const T inv = static_cast<T>(1) / b.value;
+            return chain(b, static_cast<T>(a) * inv, -static_cast<T>(a) * inv * inv);
+        }
+
+        constexpr Var& operator+=(const Var& b) { return *this = *this + b; }
+        constexpr Var& operator-=(const Var& b) { return *this = *this - b; }
+        constexpr Var& operator*=(const Var& b) { return *this = *this * b; }
+        constexpr Var& operator/=(const Var& b) { return *this = *this / b; }
+
+        // Step 2 - Ordering on the value
+        friend constexpr bool operator==(const Var& a, const Var& b) noexcept { return a.value == b.value; }
+        friend constexpr auto operator<=>(const Var& a, const Var& b) noexcept { return a.value <=> b.value; }
+
+        template<Scalar U>
+        friend constexpr bool operator==(const Var& a, U b) noexcept { return a.value == static_cast<T>(b); }
+
+        template<Scalar U>
+        friend constexpr auto operator<=>(const Var& a, U b) noexcept { return a.value <=> static_cast<T>(b); }
+
+        // Step 3 - Elementary functions, found by argument-dependent lookup
+        friend Var exp(const Var& x) {
+            const T e = std::exp(x.value);
+            return chain(x, e, e);
+        }
+
+        friend Var log(const Var& x) { return chain(x, std::log(x.value), static_cast<T>(1) / x.value); }
+
+        friend Var log2(const Var& x) {
+            return chain(x, std::log2(x.value), std::numbers::log2e_v<T> / x.value);
+        }
+
+        friend Var sqrt(const Var& x) {
+            const T root = std::sqrt(x.value);
+            // Zero partial at the origin, as for Dual
+            return chain(x, root, root > 0 ? static_cast<T>(0.5) / root : T{});
+        }
+
+        friend Var pow(const Var& x, T p) {
+            const T xp = std::pow(x.value, p - static_cast<T>(1));
+            return chain(x, xp * x.value, p * xp);
+        }
+
+        friend Var pow(const Var& x, const Var& p) { return exp(p * log(x)); }
+
+        friend Var abs(const Var& x) { return x.value < 0 ? -x : x; }
+
+        friend Var sin(const Var& x) { return chain(x, std::sin(x.value), std::cos(x.value)); }
+        friend Var cos(const Var& x) { return chain(x, std::cos(x.value), -std::sin(x.value)); }
+
+        friend Var erf(const Var& x) {
+            constexpr T two_over_sqrt_pi = std::numbers::inv_sqrtpi_v<T> * 2;
+            return chain(x, std::erf(x.value), two_over_sqrt_pi * std::exp(-x.value * x.value));
+        }
+
+        friend Var erfc(const Var& x) {
+            constexpr T two_over_sqrt_pi = std::numbers::inv_sqrtpi_v<T> * 2;
+            return chain(x, std::erfc(x.value), -two_over_sqrt_pi * std::exp(-x.value * x.value));
+        }
+
+        // Piecewise constant: not on the tape
+        friend Var floor(const Var& x) { return Var(std::floor(x.value)); }
+        friend Var ceil(const Var& x) { return Var(std::ceil(x.value)); }
+    };
+
+    template<Scalar T>
+    struct scalar_type<Var<T>> {
+        using type = T;
+    };
+
+    /**
+     * Arena-allocated tape of Var operations
+     * Nodes live in fixed-size blocks that are never freed or moved while the
+     * tape lives: recording is a bump of the size, and rewinding only moves
+     * it back, so a tape reused across paths allocates nothing once it has
+     * reached its peak size. Node 0 is a sink that takes the (zero) partials
+     * towards constants.
+     *
+     * Checkpointing: mark() remembers the current end, propagate(mark) sweeps
+     * only the nodes recorded since, adding their adjoints into the earlier
+     * nodes they depend on, and rewind(mark) discards them. Pricing engines
+     * record the inputs and per-run setup once, then per path: record,
+     * propagate(mark), rewind(mark), so the tape never holds more than the
+     * setup plus one path (see MonteCarloPricer::price_adjoint).
+     *
+     * Operations record onto the thread's active tape, set by a Scope.
+     */
+    template<Scalar T = double>
+    class Tape {
+    public:
+        // One recorded operation: up to two parents and the local partials
+        struct Node {
+            T adjoint;
+            std::array<T, 2> partial;
+            std::array<std::uint32_t, 2> parent;
+        };
+
+        // Makes a tape the active one of the calling thread for its lifetime
+        class Scope {
+        public:
+            explicit Scope(Tape& tape) noexcept : previous_(std::exchange(active_, &tape)) {}
+            ~Scope() { active_ = previous_; }
+
+            Scope(const Scope&) = delete;
+            Scope& operator=(const Scope&) = delete;
+
+        private:
+            Tape* previous_;
+        };
+
+        Tape() {
+            record(0, T{}, 0, T{});  // node 0: sink of constants
+        }
+
+        // Tape of the calling thread (requires a live Scope)
+        static Tape& active() noexcept { return *active_; }
+
+        // New independent input
+        Var<T> variable(T value) {
+            return Var<T>(value, record(0, T{}, 0, T{}));
+        }
+
+        size_t size() const noexcept { return size_; }
+
+        // Nodes the arena can hold before it allocates another block
+        size_t capacity() const noexcept { return blocks_.size() * block_nodes; }
+
+        // Checkpoint: the current end of the tape
+        size_t mark() const noexcept { return size_; }
+
+        // Discard every node recorded after `mark`
+        void rewind(size_t mark) noexcept { size_ = std::max<size_t>(mark, 1); }
+
+        // Discard everything but the sink
+        void clear() noexcept {
+            size_ = 1;
+            node(0).adjoint = T{};
+        }
+
+        T adjoint(const Var<T>& x) const noexcept {
+            return x.index == 0 ? T{} : node(x.index).adjoint;
+        }
+
+        // Adds `weight` to the adjoint of output y (∂result/∂y)
+        void seed(const Var<T>& y, T weight = static_cast<T>(1)) noexcept {
+            if (y.index != 0) node(y.index).adjoint += weight;
+        }
+
+        /**
+         * Backward sweep over the nodes recorded since `mark`, newest first:
+         * adjoint(parent) += partial * adjoint(node)
+         */
+        void propagate(size_t mark = 1) noexcept {
+            for (size_t i = size_; i-- > std::max<size_t>(mark, 1);) {
+                const Node& n = node(i);
+                const T a = n.adjoint;
+                if (a == T{}) continue;
+                node(n.parent[0]).adjoint += n.partial[0] * a;
+                node(n.parent[1]).adjoint += n.partial[1] * a;
+            }
+        }
+
+        // Zero the adjoints of nodes [first, size)
+        void zero_adjoints(size_t first = 0) noexcept {
+            for (size_t i = first; i < size_; ++i) {
+                node(i).adjoint = T{};
+            }
+        }
+
+        std::uint32_t record(std::uint32_t a, T da, std::uint32_t b, T db) {
+            if (size_ == capacity()) {
+                if (capacity() >= std::numeric_limits<std::uint32_t>::max())
+                    throw std::length_error("Tape is full");
+                blocks_.push_back(std::make_unique<Node[]>(block_nodes));
+            }
+            node(size_) = { .adjoint = T{}, .partial = { da, db }, .parent = { a, b } };
+            return static_cast<std::uint32_t>(size_++);
+        }
+
+    private:
+        // 16K nodes per block
+        static constexpr size_t block_bits = 14;
+        static constexpr size_t block_nodes = size_t{ 1 } << block_bits;
+
+        Node& node(size_t i) noexcept { return blocks_[i >> block_bits][i & (block_nodes - 1)]; }
+        const Node& node(size_t i) const noexcept { return blocks_[i >> block_bits][i & (block_nodes - 1)]; }
+
+        std::vector<std::unique_ptr<Node[]>> blocks_;
+        size_t size_ = 0;
+
+        static inline thread_local Tape* active_ = nullptr;
+    };
+
+} // namespace ito::math
@@ -0,0 +1,228 @@
+#pragma once
+#include <ito/utils/math.hpp>
+#include <array>
+#include <cmath>
+#include <compare>
+#include <cstddef>
+#include <numbers>
+
+namespace ito::math {
+
+    /**
+     * Forward-mode dual number with N tangent directions
+     * x = value + Σ_i grad[i] ε_i, ε_i ε_j = 0: every operation carries the
+     * exact derivative of its result with respect to N seeded inputs, so one
+     * evaluation of a model templated on T yields the value and N first-order
+     * sensitivities (instead of N + 1 bumped revaluations).
+     *
+     *     using D = Dual<double, 3>;
+     *     BlackScholesModel<D> model({
+     *         .spot_price = D::variable(100.0, 0),   // ∂/∂S
+     *         .strike_price = 100.0,
+     *         .risk_free_rate = D::variable(0.05, 2), // ∂/∂r
+     *         .volatility = D::variable(0.2, 1),      // ∂/∂σ
+     *         .time_to_maturity = 1.0 });
+     *     const D C = model.call_price();  // C.value, C.grad = { Δ, vega, ρ }
+     *
+     * The tangents are a fixed-size array updated by plain loops over N, so
+     * each operation compiles to a few packed vector instructions. T may be
+     * a Dual itself (Dual<Dual<double, 1>, 1> carries second derivatives).
+     *
+     * Comparisons look at the value only; branches therefore follow the
+     * value, and a kink (max, abs) contributes its one-sided derivative.
+     */
+    template<Arithmetic T = double, size_t N = 1>
+    struct Dual {
+        using value_type = T;
+        static constexpr size_t num_tangents = N;
+
+        T value{};
+        std::array<T, N> grad{};
+
+        constexpr Dual() = default;
+
+        // Constants: zero tangents
+        constexpr Dual(const T& v) noexcept : value(v) {}
+
+        template<Scalar U>
+        constexpr Dual(U v) noexcept : value(static_cast<T>(v)) {}
+
+        constexpr Dual(const T& v, const std::array<T, N>& tangents) noexcept : value(v), grad(tangents) {}
+
+        // Input number i: value v with unit tangent in direction i
+        static constexpr Dual variable(const T& v, size_t i) noexcept {
+            Dual x(v);
+            x.grad[i] = static_cast<T>(1);
+            return x;
+        }
+
+        constexpr const T& derivative(size_t i) const noexcept { return grad[i]; }
+
+        // Step 1 - Compound assignment (the binary operators build on these)
+        constexpr Dual& operator+=(const Dual& b) noexcept {
+            value += b.value;
+            for (size_t i{}; i < N; ++i) grad[i] += b.grad[i];
+            return *this;
+        }
+
+        constexpr Dual& operator-=(const Dual& b) noexcept {
+            value -= b.value;
+            for (size_t i{}; i < N; ++i) grad[i] -= b.grad[i];
+            return *this;
+        }
+
+        constexpr Dual& operator*=(const Dual& b) noexcept {
+            for (size_t i{}; i < N; ++i) grad[i] = grad[i] * b.value + value * b.grad[i];
+            value *= b.value;
+            return *this;
+        }
+
+        constexpr Dual& operator/=(const Dual& b) noexcept {
+            const T inv = static_cast<T>(1) / b.value;
+            value *= inv;
+            for (size_t i{}; i < N; ++i) grad[i] = (grad[i] - value * b.grad[i]) * inv;
+            return *this;
+        }
+
+        // Scalars touch the value (and scale the tangents) only
+        template<Scalar U>
+        constexpr Dual& operator+=(U b) noexcept { value += static_cast<T>(b); return *this; }
+
+        template<Scalar U>
+        constexpr Dual& operator-=(U b) noexcept { value -= static_cast<T>(b); return *this; }
+
+        template<Scalar U>
+        constexpr Dual& operator*=(U b) noexcept {
+            const T s = static_cast<T>(b);
+            value *= s;
+            for (size_t i{}; i < N; ++i) grad[i] *= s;
+            return *this;
+        }
+
+        template<Scalar U>
+        constexpr Dual& operator/=(U b) noexcept { return *this *= static_cast<T>(1) / static_cast<T>(b); }
+
+        // Step 2 - Arithmetic
+        constexpr Dual operator+() const noexcept { return *this; }
+
+        constexpr Dual operator-() const noexcept {
+            Dual r;
+            r.value = -value;
+            for (size_t i{}; i < N; ++i) r.grad[i] = -grad[i];
+            return r;
+        }
+
+        friend constexpr Dual operator+(Dual a, const Dual& b) noexcept { return a += b; }
+        friend constexpr Dual operator-(Dual a, const Dual& b) noexcept { return a -= b; }
+        friend constexpr Dual operator*(Dual a, const Dual& b) noexcept { return a *= b; }
+        friend constexpr Dual operator/(Dual a, const Dual& b) noexcept { return a /= b; }
+
+        template<Scalar U> friend constexpr Dual operator+(Dual a, U b) noexcept { return a += b; }
+        template<Scalar U> friend constexpr Dual operator-(Dual a, U b) noexcept { return a -= b; }
+        template<Scalar U> friend constexpr Dual operator*(Dual a, U b) noexcept { return a *= b; }
+        template<Scalar U> friend constexpr Dual operator/(Dual a, U b) noexcept { return a /= b; }
+
+        template<Scalar U> friend constexpr Dual operator+(U a, Dual b) noexcept { return b += a; }
+        template<Scalar U> friend constexpr Dual operator-(U a, const Dual& b) noexcept { return -b + a; }
+        template<Scalar U> friend constexpr Dual operator*(U a, Dual b) noexcept { return b *= a; }
+
+        template<Scalar U>
+        friend constexpr Dual operator/(U a, const Dual& b) noexcept {
+            // d(a/b) = -a/b² db
+            const T inv = static_cast<T>(1) / b.value;
+            return chain(b, static_cast<T>(a) * inv, -static_cast<T>(a) * inv * inv);
+        }
+
+        // Step 3 - Ordering on the value
+        friend constexpr bool operator==(const Dual& a, const Dual& b) noexcept { return a.value == b.value; }
+        friend constexpr auto operator<=>(const Dual& a, const Dual& b) noexcept { return a.value <=> b.value; }
+
+        template<Scalar U>
+        friend constexpr bool operator==(const Dual& a, U b) noexcept { return a.value == static_cast<T>(b); }
+
+        template<Scalar U>
+        friend constexpr auto operator<=>(const Dual& a, U b) noexcept { return a.value <=> static_cast<T>(b); }
+
+        /**
+         * f(x) from its value f and derivative f' at x.value (chain rule)
+         * Building block of the elementary functions below; also the way to
+         * lift a scalar routine with a known derivative onto Dual.
+         */
+        friend constexpr Dual chain(const Dual& x, const T& f, const T& df) noexcept {
+            Dual r(f);
+            for (size_t i{}; i < N; ++i) r.grad[i] = df * x.grad[i];
+            return r;
+        }
+
+        // Step 4 - Elementary functions, found by argument-dependent lookup
+        // (generic code calls them unqualified after `using std::exp;` etc.)
+        friend Dual exp(const Dual& x) noexcept {
+            using std::exp;
+            const T e = exp(x.value);
+            return chain(x, e, e);
+        }
+
+        friend Dual log(const Dual& x) noexcept {
+            using std::log;
+            return chain(x, log(x.value), static_cast<T>(1) / x.value);
+        }
+
+        friend Dual log2(const Dual& x) noexcept {
+            using std::log2;
+            return chain(x, log2(x.value), std::numbers::log2e_v<scalar_t<T>> / x.value);
+        }
+
+        friend Dual sqrt(const Dual& x) noexcept {
+            using std::sqrt;
+            const T root = sqrt(x.value);
+            // Zero tangent at the origin, so e.g. a zero variance does not turn
+            // the derivative of its standard error into inf * 0
+            return chain(x, root, root > 0 ? static_cast<T>(0.5) / root : T{});
+        }
+
+        friend Dual pow(const Dual& x, const T& p) noexcept {
+            using std::pow;
+            const T xp = pow(x.value, p - static_cast<T>(1));
+            return chain(x, xp * x.value, p * xp);
+        }
+
+        friend Dual pow(const Dual& x, const Dual& p) noexcept {
+            return exp(p * log(x));
+        }
+
+        friend Dual abs(const Dual& x) noexcept { return x.value < 0 ? -x : x; }
+
+        friend Dual sin(const Dual& x) noexcept {
+            using std::sin, std::cos;
+            return chain(x, sin(x.value), cos(x.value));
+        }
+
+        friend Dual cos(const Dual& x) noexcept {
+            using std::sin, std::cos;
+            return chain(x, cos(x.value), -sin(x.value));
+        }
+
+        friend Dual erf(const Dual& x) noexcept {
+            using std::erf, std::exp;
+            constexpr scalar_t<T> two_over_sqrt_pi = std::numbers::inv_sqrtpi_v<scalar_t<T>> * 2;
+            return chain(x, erf(x.value), two_over_sqrt_pi * exp(-x.value * x.value));
+        }
+
+        friend Dual erfc(const Dual& x) noexcept {
+            using std::erfc, std::exp;
+            constexpr scalar_t<T> two_over_sqrt_pi = std::numbers::inv_sqrtpi_v<scalar_t<T>> * 2;
+            return chain(x, erfc(x.value), -two_over_sqrt_pi * exp(-x.value * x.value));
+        }
+
+        // Piecewise constant: zero tangents
+        friend Dual floor(const Dual& x) noexcept { using std::floor; return Dual(floor(x.value)); }
+        friend Dual ceil(const Dual& x) noexcept { using std::ceil; return Dual(ceil(x.value)); }
+    };
+
+    // The scalar underneath nested duals
+    template<Arithmetic T, size_t N>
+    struct scalar_type<Dual<T, N>> {
+        using type = scalar_t<T>;
+    };
+
+} // namespace ito::math
@@ -0,0 +1,212 @@
+#pragma once
+#include <ito/utils/math.hpp>
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <span>
+#include <utility>
+#include <vector>
+
+namespace ito::math {
+
+    /**
+     * In-place Cholesky factorization A = L * L^T
+     * a: n x n symmetric positive definite matrix, row-major
+     * On success the lower triangle holds L (the upper triangle is left untouched).
+     * Returns false if a pivot is not strictly positive (A not positive definite).
+     */
+    template<Arithmetic T = double>
+    bool cholesky_decompose(std::span<T> a, size_t n) noexcept {
+        for (size_t j{}; j < n; ++j) {
+            T diag = a[j * n + j];
+            for (size_t k{}; k < j; ++k) {
+                diag -= a[j * n + k] * a[j * n + k];
+            }
+            if (!(diag > static_cast<T>(0))) return false;
+
+            using std::sqrt;
+            const T l_jj = sqrt(diag);
+            a[j * n + j] = l_jj;
+
+            for (size_t i = j + 1; i < n; ++i) {
+                T sum = a[i * n + j];
+                for (size_t k{}; k < j; ++k) {
+                    sum -= a[i * n + k] * a[j * n + k];
+                }
+                a[i * n + j] = sum / l_jj;
+            }
+        }
+        return true;
+    }
+
+    /**
+     * Solve (L * L^T) x = b in place, given the factor from cholesky_decompose
+     * Forward substitution L y = b, then back substitution L^T x = y.
+     */
+    template<Arithmetic T = double>
+    void cholesky_solve(std::span<const T> l, size_t n, std::span<T> b) noexcept {
+        for (size_t i{}; i < n; ++i) {
+            T sum = b[i];
+            for (size_t k{}; k < i; ++k) {
+                sum -= l[i * n + k] * b[k];
+            }
+            b[i] = sum / l[i * n + i];
+        }
+        for (size_t i = n; i-- > 0;) {
+            T sum = b[i];
+            for (size_t k = i + 1; k < n; ++k) {
+                sum -= l[k * n + i] * b[k];
+            }
+            b[i] = sum / l[i * n + i];
+        }
+    }
+
+    /**
+     * Eigen-decomposition of a symmetric matrix A = V diag(λ) Vᵀ, cyclic Jacobi
+     * a: n x n symmetric, row-major; overwritten (driven to diagonal)
+     * values:  n eigenvalues, sorted in decreasing order
+     * vectors: n x n row-major, column j is the unit eigenvector of values[j]
+     * Meant for small dense matrices factored once (correlations); O(n³) per sweep.
+     */
+    template<Arithmetic T = double>
+    void symmetric_eigen(std::span<T> a, size_t n, std::span<T> values, std::span<T> vectors) {
+        std::fill_n(vectors.begin(), n * n, T{});
+        for (size_t i{}; i < n; ++i) vectors[i * n + i] = static_cast<T>(1);
+
+        // Step 1 - Rotate away off-diagonal entries until they are negligible
+        for (int sweep{}; sweep < 64; ++sweep) {
+            T off{};
+            T diag{};
+            for (size_t i{}; i < n; ++i) {
+                diag += a[i * n + i] * a[i * n + i];
+                for (size_t j = i + 1; j < n; ++j) off += a[i * n + j] * a[i * n + j];
+            }
+            if (!(off > std::numeric_limits<T>::epsilon() * std::numeric_limits<T>::epsilon() * diag)) break;
+
+            for (size_t p{}; p < n; ++p) {
+                for (size_t q = p + 1; q < n; ++q) {
+                    const T a_pq = a[p * n + q];
+                    if (a_pq == T{}) continue;
+
+                    // Rotation angle that zeroes a_pq (Golub & Van Loan, 8.5.2)
+                    const T theta = (a[q * n + q] - a[p * n + p]) / (static_cast<T>(2) * a_pq);
+                    const T t = (theta >= T{} ? static_cast<T>(1) : static_cast<T>(-1))
+                        / (std::abs(theta) + std::sqrt(theta * theta + static_cast<T>(1)));
+                    const T c = static_cast<T>(1) / std::sqrt(t * t + static_cast<T>(1));
+                    const T s = t * c;
+
+                    // A <- Jᵀ A J on rows/columns p and q, V <- V J
+                    for (size_t k{}; k < n; ++k) {
+                        const T a_kp = a[k * n + p];
+                        const T a_kq = a[k * n + q];
+                        a[k * n + p] = c * a_kp - s * a_kq;
+                        a[k * n + q] = s * a_kp + c * a_kq;
+                    }
+                    for (size_t k{}; k < n; ++k) {
+                        const T a_pk = a[p * n + k];
+                        const T a_qk = a[q * n + k];
+                        a[p * n + k] = c * a_pk - s * a_qk;
+                        a[q * n + k] = s * a_pk + c * a_qk;
+                    }
+                    for (size_t k{}; k < n; ++k) {
+                        const T v_kp = vectors[k * n + p];
+                        const T v_kq = vectors[k * n + q];
+                        vectors[k * n + p] = c * v_kp - s * v_kq;
+                        vectors[k * n + q] = s * v_kp + c * v_kq;
+                    }
+                }
+            }
+        }
+
+        // Step 2 - Sort eigenpairs by decreasing eigenvalue (selection sort, swaps columns)
+        for (size_t i{}; i < n; ++i) values[i] = a[i * n + i];
+        for (size_t i{}; i < n; ++i) {
+            size_t best = i;
+            for (size_t j = i + 1; j < n; ++j) {
+                if (values[j] > values[best]) best = j;
+            }
+            if (best == i) continue;
+            std::swap(values[i], values[best]);
+            for (size_t k{}; k < n; ++k) std::swap(vectors[k * n + i], vectors[k * n + best]);
+        }
+    }
+
+    /**
+     * Blocked accumulator for the least-squares normal equations (AᵀA) β = Aᵀy
+     * Rows of A arrive in tiles stored column-major (column j of an m-row tile
+     * at columns[j*m .. j*m + m)), so each Gram entry is a unit-stride dot
+     * product over a tile that stays in L1. Accumulators over different row
+     * ranges merge by addition; solve() factors AᵀA with cholesky_decompose.
+     */
+    template<Arithmetic T = double>
+    class NormalEquations {
+    public:
+        NormalEquations() = default;
+
+        explicit NormalEquations(size_t size)
+            : size_(size), gram_(size * size), rhs_(size)
+        {
+        }
+
+        size_t size() const noexcept { return size_; }
+        size_t count() const noexcept { return count_; }
+
+        // Add the rows of a column-major tile (size() columns of y.size() rows)
+        void push_tile(std::span<const T> columns, std::span<const T> y) noexcept {
+            const size_t m = y.size();
+            for (size_t j{}; j < size_; ++j) {
+                const T* a_j = columns.data() + j * m;
+                for (size_t k{}; k <= j; ++k) {
+                    gram_[j * size_ + k] += dot(a_j, columns.data() + k * m, m);  // lower triangle only
+                }
+                rhs_[j] += dot(a_j, y.data(), m);
+            }
+            count_ += m;
+        }
+
+        void merge(const NormalEquations& other) noexcept {
+            if (other.count_ == 0) return;
+            if (count_ == 0) {
+                *this = other;
+                return;
+            }
+            for (size_t i{}; i < gram_.size(); ++i) gram_[i] += other.gram_[i];
+            for (size_t j{}; j < size_; ++j) rhs_[j] += other.rhs_[j];
+            count_ += other.count_;
+        }
+
+        // Least-squares coefficients; false if AᵀA is not positive definite
+        // (fewer rows than columns, or collinear columns)
+        bool solve(std::span<T> beta) const {
+            if (count_ < size_) return false;
+
+            std::vector<T> l(gram_);
+            if (!cholesky_decompose(std::span<T>(l), size_)) return false;
+
+            std::copy(rhs_.begin(), rhs_.end(), beta.begin());
+            cholesky_solve(std::span<const T>(l), size_, beta.first(size_));
+            return true;
+        }
+
+    private:
+        // Four independent partial sums, so the reduction vectorizes without
+        // reassociating floating-point math
+        static T dot(const T* a, const T* b, size_t m) noexcept {
+            std::array<T, 4> sum{};
+            size_t i{};
+            for (; i + 4 <= m; i += 4) {
+                for (size_t l{}; l < 4; ++l) sum[l] += a[i + l] * b[i + l];
+            }
+            for (; i < m; ++i) sum[0] += a[i] * b[i];
+            return (sum[0] + sum[1]) + (sum[2] + sum[3]);
+        }
+
+        size_t size_ = 0;
+        size_t count_ = 0;
+        std::vector<T> gram_;  // AᵀA, row-major, lower triangle
+        std::vector<T> rhs_;   // Aᵀy
+    };
+
+} // namespace ito::math
@@ -2,14 +2,44 @@
 #include <cmath>
 #include <concepts>
 #include <numbers>
+#include <type_traits>
 
 namespace ito::math {
+	// Built-in integer or floating-point type
 	template<typename T>
-	concept Arithmetic = std::is_arithmetic_v<T>;
+	concept Scalar = std::is_arithmetic_v<T>;
+
+	/**
+	 * Anything that computes like a real number: the built-in types, or a
+	 * number type (e.g. Dual) with the field operations, an ordering and
+	 * construction from double. Elementary functions of number types are
+	 * found by argument-dependent lookup, so generic code calls them
+	 * unqualified after `using std::exp;` etc.
+	 */
+	template<typename T>
+	concept Arithmetic = Scalar<T> || (std::copyable<T> && std::constructible_from<T, double>
+		&& requires(T a, T b) {
+			{ a + b } -> std::convertible_to<T>;
+			{ a - b } -> std::convertible_to<T>;
+			{ a * b } -> std::convertible_to<T>;
+			{ a / b } -> std::convertible_to<T>;
+			{ -a } -> std::convertible_to<T>;
+			{ a < b } -> std::convertible_to<bool>;
+		});
+
+	// Built-in type underneath a number type (T itself for Scalar types);
+	// number types specialize it next to their definition
+	template<typename T>
+	struct scalar_type {
+		using type = T;
+	};
+
+	template<typename T>
+	using scalar_t = typename scalar_type<T>::type;
 	
 	namespace constants {
 		template<Arithmetic T = double>
-		inline constexpr T inv_sqrt_2pi = std::numbers::inv_sqrtpi_v<T> / std::numbers::sqrt2_v<T>;
+		inline constexpr T inv_sqrt_2pi = static_cast<T>(std::numbers::inv_sqrtpi_v<scalar_t<T>> / std::numbers::sqrt2_v<scalar_t<T>>);
 	
 		template<Arithmetic T = double>
 		inline constexpr T sqrt_2 = static_cast<T>(std::numbers::sqrt2);
@@ -23,41 +53,80 @@ namespace ito::math {
 
 	template<Arithmetic T = double>
 	constexpr T normal_pdf(T x) noexcept {
-		return constants::inv_sqrt_2pi<T> * std::exp(-x * x / static_cast<T>(2));
+		using std::exp;
+		return constants::inv_sqrt_2pi<T> * exp(-x * x / static_cast<T>(2));
 	}
 
 	/**
 	 * Cumulative distribution function (CDF)
 	 * Phi(x) = P(X <= x) for standard normal distribution
 	 * no closed-form solution
-	 * using Abramowitz & Stegun formula
+	 * Phi(x) = erfc(-x / sqrt(2)) / 2, accurate to machine precision in both
+	 * tails; number types (e.g. Dual) find their erfc by argument-dependent
+	 * lookup, so every T agrees on the value and the derivative is phi itself
 	 */
 	template<Arithmetic T = double>
 	inline T normal_cdf(T x) noexcept {
-		if (x < 0) {
-			return static_cast<T>(1) - normal_cdf(-x);  // Phi(-x) = 1 - Phi(x)
-		}
+		using std::erfc;
+		return static_cast<T>(0.5) * erfc(-x / constants::sqrt_2<T>);
+	}
+
+	/**
+	 * Inverse of the standard normal CDF: returns x with Phi(x) = p, p in (0, 1)
+	 * using Acklam's rational approximation (2003)
+	 * central region |p - 0.5| <= 0.47575 and two tail regions
+	 * Relative error < 1.15 * 10^-9
+	 * Maps uniforms (e.g. quasi-random points) to N(0,1) variates
+	 */
+	template<Arithmetic T = double>
+	inline T inverse_normal_cdf(T p) noexcept {
+		constexpr T a1 = -3.969683028665376e+01;
+		constexpr T a2 = 2.209460984245205e+02;
+		constexpr T a3 = -2.759285104469687e+02;
+		constexpr T a4 = 1.383577518672690e+02;
+		constexpr T a5 = -3.066479806614716e+01;
+		constexpr T a6 = 2.506628277459239e+00;
 
-		// Abramowitz & Stegun approximation (1964)
-		// Error < 7.5 * 10^-8
+		constexpr T b1 = -5.447609879822406e+01;
+		constexpr T b2 = 1.615858368580409e+02;
+		constexpr T b3 = -1.556989798598866e+02;
+		constexpr T b4 = 6.680131188771972e+01;
+		constexpr T b5 = -1.328068155288572e+01;
 
-		constexpr T a1 = 0.319381530;
-		constexpr T a2 = -0.356563782;
-		constexpr T a3 = 1.781477937;
-		constexpr T a4 = -1.821255978;
-		constexpr T a5 = 1.330274429;
-		constexpr T p = 0.2316419;
+		constexpr T c1 = -7.784894002430293e-03;
+		constexpr T c2 = -3.223964580411365e-01;
+		constexpr T c3 = -2.400758277161838e+00;
+		constexpr T c4 = -2.549732539343734e+00;
+		constexpr T c5 = 4.374664141464968e+00;
+		constexpr T c6 = 2.938163982698783e+00;
 
-		const T t = static_cast<T>(1) / (static_cast<T>(1) + p * x);
-		//const T t2 = t * t;
-		//const T t3 = t2 * t;
-		//const T t4 = t3 * t;
-		//const T t5 = t4 * t;
+		constexpr T d1 = 7.784695709041462e-03;
+		constexpr T d2 = 3.224671290700398e-01;
+		constexpr T d3 = 2.445134137142996e+00;
+		constexpr T d4 = 3.754408661907416e+00;
 
-		// Polynomial evaluation using Horner's method
-		// alternatively: const T poly = a1 * t + a2 * t2 + a3 * t3 + a4 * t4 + a5 * t5; (less efficient)
-		const T poly = t * (a1 + t * (a2 + t * (a3 + t * (a4 + t * a5))));
+		constexpr T p_low = 0.02425;
+		constexpr T p_high = static_cast<T>(1) - p_low;
+
+		using std::sqrt, std::log;
+
+		if (p < p_low) {
+			// Lower tail
+			const T q = sqrt(static_cast<T>(-2) * log(p));
+			return (((((c1 * q + c2) * q + c3) * q + c4) * q + c5) * q + c6)
+				/ ((((d1 * q + d2) * q + d3) * q + d4) * q + static_cast<T>(1));
+		}
+		if (p > p_high) {
+			// Upper tail (by symmetry)
+			const T q = sqrt(static_cast<T>(-2) * log(static_cast<T>(1) - p));
+			return -(((((c1 * q + c2) * q + c3) * q + c4) * q + c5) * q + c6)
+				/ ((((d1 * q + d2) * q + d3) * q + d4) * q + static_cast<T>(1));
+		}
 
-		return static_cast<T>(1) - normal_pdf(x) * poly;
+		// Central region
+		const T q = p - static_cast<T>(0.5);
+		const T r = q * q;
+		return (((((a1 * r + a2) * r + a3) * r + a4) * r + a5) * r + a6) * q
+			/ (((((b1 * r + b2) * r + b3) * r + b4) * r + b5) * r + static_cast<T>(1));
 	}
 }
\ No newline at end of file
@@ -0,0 +1,364 @@
+#pragma once
+#include <ito/utils/math.hpp>
+#include <ito/utils/vmath.hpp>
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <numbers>
+#include <span>
+
+#if defined(__AVX2__) || defined(__AVX512F__)
+#include <immintrin.h>
+#endif
+
+namespace ito::random {
+
+    /**
+     * Philox4x32-10 counter-based generator
+     * Salmon, Moraes, Dror & Shaw, "Parallel Random Numbers: As Easy as 1, 2, 3" (SC'11)
+     *
+     * A keyed bijection on 128-bit counters: there is no state to advance, so
+     * draw n of any stream is computed directly from n. Workers can therefore
+     * index the stream by path number and the result does not depend on how
+     * paths are split between threads.
+     */
+    class Philox4x32 {
+    public:
+        using counter_type = std::array<std::uint32_t, 4>;
+        using key_type = std::array<std::uint32_t, 2>;
+
+        static constexpr int rounds = 10;
+
+        constexpr explicit Philox4x32(std::uint64_t seed) noexcept
+            : key_{ static_cast<std::uint32_t>(seed), static_cast<std::uint32_t>(seed >> 32) }
+        {
+        }
+
+        constexpr counter_type operator()(counter_type ctr) const noexcept {
+            key_type key = key_;
+            for (int i{}; i < rounds; ++i) {
+                ctr = round(ctr, key);
+                key[0] += W0;
+                key[1] += W1;
+            }
+            return ctr;
+        }
+
+        constexpr const key_type& key() const noexcept { return key_; }
+
+        /**
+         * Batch form: blocks first_block .. first_block + count - 1 of the
+         * stream whose upper counter words are (word2, word3), written in
+         * structure-of-arrays form (out0[b] .. out3[b] = words of block b).
+         * Uses AVX-512F (16 lanes) or AVX2 (8 lanes) when compiled for them;
+         * results are identical to operator() on every path.
+         */
+        void generate_blocks(
+            std::uint64_t first_block,
+            std::uint32_t word2,
+            std::uint32_t word3,
+            size_t count,
+            std::uint32_t* out0,
+            std::uint32_t* out1,
+            std::uint32_t* out2,
+            std::uint32_t* out3
+        ) const noexcept {
+            size_t b = 0;
+#if defined(__AVX512F__)
+            for (; b + 16 <= count; b += 16) {
+                generate_lanes<16>(first_block + b, word2, word3, out0 + b, out1 + b, out2 + b, out3 + b);
+            }
+#endif
+#if defined(__AVX2__)
+            for (; b + 8 <= count; b += 8) {
+                generate_lanes<8>(first_block + b, word2, word3, out0 + b, out1 + b, out2 + b, out3 + b);
+            }
+#endif
+            for (; b < count; ++b) {
+                const std::uint64_t block = first_block + b;
+                const counter_type r = (*this)({
+                    static_cast<std::uint32_t>(block),
+                    static_cast<std::uint32_t>(block >> 32),
+                    word2,
+                    word3
+                });
+                out0[b] = r[0];
+                out1[b] = r[1];
+                out2[b] = r[2];
+                out3[b] = r[3];
+            }
+        }
+
+    private:
+        // Multipliers and Weyl key increments from the reference implementation
+        static constexpr std::uint32_t M0 = 0xD2511F53;
+        static constexpr std::uint32_t M1 = 0xCD9E8D57;
+        static constexpr std::uint32_t W0 = 0x9E3779B9;
+        static constexpr std::uint32_t W1 = 0xBB67AE85;
+
+        key_type key_;
+
+#if defined(__AVX512F__)
+        // 16 x (32 x 32 -> 64) multiplies: even lanes directly, odd lanes shifted down
+        // (zero-masked forms with every lane set: GCC 12 builds the unmasked ones
+        // on _mm512_undefined_epi32(), which warns under -flto, GCC bug 105593)
+        static void mulhilo(__m512i a, __m512i m, __m512i& hi, __m512i& lo) noexcept {
+            constexpr __mmask8 all = 0xFF;
+            const __m512i even = _mm512_maskz_mul_epu32(all, a, m);
+            const __m512i odd = _mm512_maskz_mul_epu32(all, _mm512_maskz_srli_epi64(all, a, 32), m);
+            lo = _mm512_mask_blend_epi32(0xAAAA, even, _mm512_maskz_slli_epi64(all, odd, 32));
+            hi = _mm512_mask_blend_epi32(0xAAAA, _mm512_maskz_srli_epi64(all, even, 32), odd);
+        }
+#endif
+#if defined(__AVX2__)
+        static void mulhilo(__m256i a, __m256i m, __m256i& hi, __m256i& lo) noexcept {
+            const __m256i even = _mm256_mul_epu32(a, m);
+            const __m256i odd = _mm256_mul_epu32(_mm256_srli_epi64(a, 32), m);
+            lo = _mm256_blend_epi32(even, _mm256_slli_epi64(odd, 32), 0xAA);
+            hi = _mm256_blend_epi32(_mm256_srli_epi64(even, 32), odd, 0xAA);
+        }
+#endif
+
+#if defined(__AVX2__) || defined(__AVX512F__)
+        // Philox rounds on Lanes consecutive blocks held one counter word per register
+        template<int Lanes>
+        void generate_lanes(
+            std::uint64_t first_block,
+            std::uint32_t word2,
+            std::uint32_t word3,
+            std::uint32_t* out0,
+            std::uint32_t* out1,
+            std::uint32_t* out2,
+            std::uint32_t* out3
+        ) const noexcept {
+            alignas(64) std::uint32_t lo_words[Lanes];
+            alignas(64) std::uint32_t hi_words[Lanes];
+            for (int i{}; i < Lanes; ++i) {
+                lo_words[i] = static_cast<std::uint32_t>(first_block + i);
+                hi_words[i] = static_cast<std::uint32_t>((first_block + i) >> 32);
+            }
+
+            if constexpr (Lanes == 16) {
+#if defined(__AVX512F__)
+                __m512i c0 = _mm512_load_si512(lo_words);
+                __m512i c1 = _mm512_load_si512(hi_words);
+                __m512i c2 = _mm512_set1_epi32(static_cast<int>(word2));
+                __m512i c3 = _mm512_set1_epi32(static_cast<int>(word3));
+                __m512i k0 = _mm512_set1_epi32(static_cast<int>(key_[0]));
+                __m512i k1 = _mm512_set1_epi32(static_cast<int>(key_[1]));
+                const __m512i m0 = _mm512_set1_epi32(static_cast<int>(M0));
+                const __m512i m1 = _mm512_set1_epi32(static_cast<int>(M1));
+                const __m512i w0 = _mm512_set1_epi32(static_cast<int>(W0));
+                const __m512i w1 = _mm512_set1_epi32(static_cast<int>(W1));
+
+                for (int i{}; i < rounds; ++i) {
+                    __m512i hi0, lo0, hi1, lo1;
+                    mulhilo(c0, m0, hi0, lo0);
+                    mulhilo(c2, m1, hi1, lo1);
+                    c0 = _mm512_xor_si512(_mm512_xor_si512(hi1, c1), k0);
+                    c1 = lo1;
+                    c2 = _mm512_xor_si512(_mm512_xor_si512(hi0, c3), k1);
+                    c3 = lo0;
+                    k0 = _mm512_add_epi32(k0, w0);
+                    k1 = _mm512_add_epi32(k1, w1);
+                }
+
+                _mm512_storeu_si512(out0, c0);
+                _mm512_storeu_si512(out1, c1);
+                _mm512_storeu_si512(out2, c2);
+                _mm512_storeu_si512(out3, c3);
+#endif
+            }
+            else {
+#if defined(__AVX2__)
+                __m256i c0 = _mm256_load_si256(reinterpret_cast<const __m256i*>(lo_words));
+                __m256i c1 = _mm256_load_si256(reinterpret_cast<const __m256i*>(hi_words));
+                __m256i c2 = _mm256_set1_epi32(static_cast<int>(word2));
+                __m256i c3 = _mm256_set1_epi32(static_cast<int>(word3));
+                __m256i k0 = _mm256_set1_epi32(static_cast<int>(key_[0]));
+                __m256i k1 = _mm256_set1_epi32(static_cast<int>(key_[1]));
+                const __m256i m0 = _mm256_set1_epi32(static_cast<int>(M0));
+                const __m256i m1 = _mm256_set1_epi32(static_cast<int>(M1));
+                const __m256i w0 = _mm256_set1_epi32(static_cast<int>(W0));
+                const __m256i w1 = _mm256_set1_epi32(static_cast<int>(W1));
+
+                for (int i{}; i < rounds; ++i) {
+                    __m256i hi0, lo0, hi1, lo1;
+                    mulhilo(c0, m0, hi0, lo0);
+                    mulhilo(c2, m1, hi1, lo1);
+                    c0 = _mm256_xor_si256(_mm256_xor_si256(hi1, c1), k0);
+                    c1 = lo1;
+                    c2 = _mm256_xor_si256(_mm256_xor_si256(hi0, c3), k1);
+                    c3 = lo0;
+                    k0 = _mm256_add_epi32(k0, w0);
+                    k1 = _mm256_add_epi32(k1, w1);
+                }
+
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(out0), c0);
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(out1), c1);
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(out2), c2);
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(out3), c3);
+#endif
+            }
+        }
+#endif
+
+        static constexpr counter_type round(const counter_type& ctr, const key_type& key) noexcept {
+            const std::uint64_t p0 = static_cast<std::uint64_t>(M0) * ctr[0];
+            const std::uint64_t p1 = static_cast<std::uint64_t>(M1) * ctr[2];
+            return {
+                static_cast<std::uint32_t>(p1 >> 32) ^ ctr[1] ^ key[0],
+                static_cast<std::uint32_t>(p1),
+                static_cast<std::uint32_t>(p0 >> 32) ^ ctr[3] ^ key[1],
+                static_cast<std::uint32_t>(p0)
+            };
+        }
+    };
+
+    /**
+     * Map 64 random bits to the open interval (0, 1)
+     * Uses as many bits as T has mantissa digits and centres the result in its
+     * bucket, so neither 0 nor 1 is ever returned (safe for log and inverse CDFs).
+     */
+    template<math::Arithmetic T = double>
+    constexpr T to_unit_interval(std::uint64_t bits) noexcept {
+        constexpr int digits = std::numeric_limits<T>::digits - 1;
+        constexpr T scale = static_cast<T>(1) / static_cast<T>(std::uint64_t{ 1 } << digits);
+        return (static_cast<T>(bits >> (64 - digits)) + static_cast<T>(0.5)) * scale;
+    }
+
+    /**
+     * Stateless random source built on Philox4x32
+     *
+     * Every draw is addressed by (dimension, index): the dimension separates
+     * independent variates of the same path (time steps, assets, ...) and the
+     * index is normally the path number. One Philox block yields two 64-bit
+     * uniforms, i.e. one Box-Muller pair, so indices 2k and 2k+1 share a block.
+     * Normals and uniforms live in disjoint counter spaces and are independent.
+     */
+    template<math::Arithmetic T = double>
+    class CounterRng {
+    public:
+        explicit CounterRng(std::uint64_t seed) noexcept
+            : philox_(seed)
+        {
+        }
+
+        // Two uniforms in (0, 1) from block `block` of `dimension`
+        std::array<T, 2> uniform_pair(std::uint64_t block, std::uint32_t dimension = 0) const noexcept {
+            const auto r = philox_({
+                static_cast<std::uint32_t>(block),
+                static_cast<std::uint32_t>(block >> 32),
+                dimension,
+                uniform_space
+            });
+            return { to_unit_interval<T>(combine(r[0], r[1])), to_unit_interval<T>(combine(r[2], r[3])) };
+        }
+
+        // Two independent N(0,1) draws from block `block` of `dimension` (Box-Muller)
+        std::array<T, 2> normal_pair(std::uint64_t block, std::uint32_t dimension = 0) const noexcept {
+            const auto r = philox_({
+                static_cast<std::uint32_t>(block),
+                static_cast<std::uint32_t>(block >> 32),
+                dimension,
+                normal_space
+            });
+            const T u1 = to_unit_interval<T>(combine(r[0], r[1]));
+            const T u2 = to_unit_interval<T>(combine(r[2], r[3]));
+
+            // Z0 = sqrt(-2 ln U1) cos(2 pi U2), Z1 = sqrt(-2 ln U1) sin(2 pi U2)
+            const T radius = std::sqrt(static_cast<T>(-2) * std::log(u1));
+            const T theta = static_cast<T>(2) * std::numbers::pi_v<T> * u2;
+            return { radius * std::cos(theta), radius * std::sin(theta) };
+        }
+
+        T uniform(std::uint64_t index, std::uint32_t dimension = 0) const noexcept {
+            return uniform_pair(index >> 1, dimension)[index & 1];
+        }
+
+        T normal(std::uint64_t index, std::uint32_t dimension = 0) const noexcept {
+            return normal_pair(index >> 1, dimension)[index & 1];
+        }
+
+        /**
+         * Batch API: out[k] = normal(first + k, dimension)
+         * Philox runs on whole SIMD registers of counters and Box-Muller on
+         * flat tiles through math::vbox_muller, so values may differ from
+         * normal() in the last bits.
+         * Every index goes through the same tiled path regardless of where a
+         * batch starts, so splitting a range into batches never changes a draw.
+         */
+        void fill_normal(std::span<T> out, std::uint64_t first, std::uint32_t dimension = 0) const noexcept {
+            fill(out, first, dimension, normal_space);
+        }
+
+        // Batch API: out[k] = uniform(first + k, dimension)
+        void fill_uniform(std::span<T> out, std::uint64_t first, std::uint32_t dimension = 0) const noexcept {
+            fill(out, first, dimension, uniform_space);
+        }
+
+    private:
+        // Fourth counter word tags the variate type
+        static constexpr std::uint32_t normal_space = 0;
+        static constexpr std::uint32_t uniform_space = 1;
+
+        // Philox blocks per tile: 128 variates, a few KB of stack
+        static constexpr size_t tile_blocks = 64;
+
+        Philox4x32 philox_;
+
+        void fill(std::span<T> out, std::uint64_t first, std::uint32_t dimension, std::uint32_t space) const noexcept {
+            alignas(64) std::array<std::uint32_t, tile_blocks> w0, w1, w2, w3;
+            alignas(64) std::array<T, tile_blocks> even, odd;
+            alignas(64) std::array<T, tile_blocks> u1, u2;
+
+            std::uint64_t block = first >> 1;
+            size_t skip = static_cast<size_t>(first & 1);  // first variate of the first block not wanted
+            size_t k = 0;
+
+            while (k < out.size()) {
+                const size_t wanted = skip + (out.size() - k);
+                const size_t blocks = std::min(tile_blocks, (wanted + 1) / 2);
+
+                // Step 1 - Random bits for the whole tile (SIMD Philox)
+                philox_.generate_blocks(block, dimension, space, blocks, w0.data(), w1.data(), w2.data(), w3.data());
+
+                // Step 2 - Two uniforms per block; SIMD Box-Muller for normals
+                if (space == normal_space) {
+                    for (size_t b{}; b < blocks; ++b) {
+                        u1[b] = to_unit_interval<T>(combine(w0[b], w1[b]));
+                        u2[b] = to_unit_interval<T>(combine(w2[b], w3[b]));
+                    }
+                    math::vbox_muller(
+                        std::span<const T>(u1.data(), blocks), std::span<const T>(u2.data(), blocks),
+                        std::span<T>(even.data(), blocks), std::span<T>(odd.data(), blocks));
+                }
+                else {
+                    for (size_t b{}; b < blocks; ++b) {
+                        even[b] = to_unit_interval<T>(combine(w0[b], w1[b]));
+                        odd[b] = to_unit_interval<T>(combine(w2[b], w3[b]));
+                    }
+                }
+
+                // Step 3 - Interleave into the output
+                const size_t take = std::min(2 * blocks - skip, out.size() - k);
+                for (size_t j{}; j < take; ++j) {
+                    const size_t v = j + skip;
+                    out[k + j] = (v & 1) ? odd[v >> 1] : even[v >> 1];
+                }
+
+                k += take;
+                block += blocks;
+                skip = 0;
+            }
+        }
+
+        static constexpr std::uint64_t combine(std::uint32_t hi, std::uint32_t lo) noexcept {
+            return (static_cast<std::uint64_t>(hi) << 32) | lo;
+        }
+    };
+
+} // namespace ito::random
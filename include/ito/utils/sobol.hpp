@@ -0,0 +1,116 @@
+#pragma once
+#include <ito/utils/math.hpp>
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+
+namespace ito::random {
+
+    /**
+     * Sobol low-discrepancy sequence (32-bit, Gray-code ordering)
+     * Direction numbers: Joe & Kuo, "Constructing Sobol sequences with better
+     * two-dimensional projections" (2008), file new-joe-kuo-6.21201
+     *
+     * Point n of dimension d is random-access (XOR of the direction numbers
+     * selected by the Gray code of n), so chunks of a parallel run can start
+     * anywhere; next() then advances in O(1) within a chunk.
+     *
+     * Randomization is a digital shift: every coordinate is XOR-ed with a
+     * per-dimension random word. Each shift gives an unbiased, still
+     * low-discrepancy point set, so independent shifts give i.i.d. estimates.
+     */
+    class SobolSequence {
+    public:
+        static constexpr std::uint32_t max_dimensions = 21;
+        static constexpr int bits = 32;
+
+        explicit SobolSequence(std::uint32_t dimensions)
+            : dimensions_(dimensions)
+        {
+            if (dimensions == 0 || dimensions > max_dimensions)
+                throw std::invalid_argument("Sobol dimension count must be between 1 and 21");
+
+            // Dimension 0 is the van der Corput sequence
+            for (int k{}; k < bits; ++k) {
+                directions_[0][k] = std::uint32_t{ 1 } << (bits - 1 - k);
+            }
+
+            // Remaining dimensions from primitive polynomials of degree s
+            for (std::uint32_t d = 1; d < dimensions; ++d) {
+                const Polynomial& poly = polynomials[d - 1];
+                const int s = poly.degree;
+                auto& v = directions_[d];
+
+                for (int k{}; k < s; ++k) {
+                    v[k] = poly.m[k] << (bits - 1 - k);
+                }
+                for (int k = s; k < bits; ++k) {
+                    v[k] = v[k - s] ^ (v[k - s] >> s);
+                    for (int j = 1; j < s; ++j) {
+                        if ((poly.a >> (s - 1 - j)) & 1u) v[k] ^= v[k - j];
+                    }
+                }
+            }
+        }
+
+        std::uint32_t dimensions() const noexcept { return dimensions_; }
+
+        // Integer coordinate of point `index` (Gray-code order) in dimension `dim`
+        std::uint32_t operator()(std::uint64_t index, std::uint32_t dim) const noexcept {
+            std::uint64_t gray = index ^ (index >> 1);
+            std::uint32_t x = 0;
+            for (int k{}; gray != 0 && k < bits; ++k, gray >>= 1) {
+                if (gray & 1u) x ^= directions_[dim][k];
+            }
+            return x;
+        }
+
+        // Advance coordinate x of point `index` to point `index + 1`
+        std::uint32_t next(std::uint32_t x, std::uint64_t index, std::uint32_t dim) const noexcept {
+            return x ^ directions_[dim][std::countr_one(index)];
+        }
+
+        // Map a (shifted) coordinate to the open interval (0, 1)
+        template<math::Arithmetic T = double>
+        static constexpr T to_unit_interval(std::uint32_t x) noexcept {
+            constexpr T scale = static_cast<T>(1) / static_cast<T>(std::uint64_t{ 1 } << bits);
+            return (static_cast<T>(x) + static_cast<T>(0.5)) * scale;
+        }
+
+    private:
+        struct Polynomial {
+            int degree;                  // s
+            std::uint32_t a;             // interior coefficients
+            std::array<std::uint32_t, 8> m;  // initial direction numbers m_1..m_s
+        };
+
+        static constexpr std::array<Polynomial, max_dimensions - 1> polynomials{ {
+            { 1, 0,  { 1 } },
+            { 2, 1,  { 1, 3 } },
+            { 3, 1,  { 1, 3, 1 } },
+            { 3, 2,  { 1, 1, 1 } },
+            { 4, 1,  { 1, 1, 3, 3 } },
+            { 4, 4,  { 1, 3, 5, 13 } },
+            { 5, 2,  { 1, 1, 5, 5, 17 } },
+            { 5, 4,  { 1, 1, 5, 5, 5 } },
+            { 5, 7,  { 1, 1, 7, 11, 19 } },
+            { 5, 11, { 1, 1, 5, 1, 1 } },
+            { 5, 13, { 1, 1, 1, 3, 11 } },
+            { 5, 14, { 1, 3, 5, 5, 31 } },
+            { 6, 1,  { 1, 3, 3, 9, 7, 49 } },
+            { 6, 13, { 1, 1, 1, 15, 21, 21 } },
+            { 6, 16, { 1, 3, 1, 13, 27, 49 } },
+            { 6, 19, { 1, 1, 1, 15, 7, 5 } },
+            { 6, 22, { 1, 3, 1, 15, 13, 25 } },
+            { 6, 25, { 1, 1, 5, 5, 19, 61 } },
+            { 7, 1,  { 1, 3, 7, 11, 23, 15, 103 } },
+            { 7, 4,  { 1, 3, 7, 13, 13, 15, 69 } }
+        } };
+
+        std::uint32_t dimensions_;
+        std::array<std::array<std::uint32_t, bits>, max_dimensions> directions_{};
+    };
+
+} // namespace ito::random
@@ -0,0 +1,476 @@
+#pragma once
+#include <ito/utils/math.hpp>
+#include <bit>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <numbers>
+#include <span>
+#include <type_traits>
+
+// The kernels rely on exact evaluation order (Cody-Waite reduction,
+// fdlibm's log reconstruction); -ffast-math reassociation would cost
+// hundreds of ulps, so it is switched off for this header only.
+#if defined(__clang__)
+#define ITO_VMATH_STRICT_FP _Pragma("clang fp reassociate(off) contract(on)")
+#elif defined(__GNUC__)
+#pragma GCC push_options
+#pragma GCC optimize("no-fast-math")
+#define ITO_VMATH_STRICT_FP
+#else
+#define ITO_VMATH_STRICT_FP
+#endif
+
+namespace ito::math {
+
+	/**
+	 * Vectorizable exp/log/sincos kernels
+	 *
+	 * poly_exp / poly_log / poly_sincos_turns are branch-free element kernels
+	 * (selects, integer bit manipulation and Horner polynomials only), so a
+	 * plain loop over them vectorizes. vexp / vlog / vbox_muller apply them to whole buffers and
+	 * pick, once at runtime, a loop compiled for AVX-512F, AVX2+FMA or the
+	 * baseline ISA.
+	 *
+	 * Max error measured against a long double reference (4M random inputs;
+	 * baseline ISA / AVX2+FMA, where contraction rounds slightly better):
+	 *   poly_exp<double>  1.32 / 1.01 ulp   on [-708, 709]
+	 *   poly_exp<float>   1.18 / 0.92 ulp   on [-87, 88]
+	 *   poly_log<double>  0.75 / 0.73 ulp   on positive normal inputs
+	 *   poly_log<float>   0.76 / 0.74 ulp   on positive normal inputs
+	 *   poly_sincos_turns 2.4 ulp double, 1.9 ulp float, on [0, 1]
+	 *                     (relative to max(|result|, 1e-3))
+	 * Outside the ranges exp saturates to 0 or +inf; log of zero, negative,
+	 * subnormal or non-finite input is unspecified.
+	 */
+
+	namespace detail {
+		template<typename T>
+		concept VectorFloat = std::is_same_v<T, float> || std::is_same_v<T, double>;
+
+		// Helpers defined inside the strict-FP region: GCC will not inline
+		// std:: functions compiled with different floating-point flags, and
+		// an out-of-line call would stop the loops from vectorizing
+		template<typename To, typename From>
+		inline To bits(From x) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+			return __builtin_bit_cast(To, x);
+#else
+			return std::bit_cast<To>(x);
+#endif
+		}
+
+		template<VectorFloat T>
+		inline T round_nearest(T x) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+			if constexpr (std::is_same_v<T, float>) return __builtin_nearbyintf(x);
+			else return __builtin_nearbyint(x);
+#else
+			return std::nearbyint(x);
+#endif
+		}
+
+		template<VectorFloat T>
+		inline T clamp(T x, T lo, T hi) noexcept {
+			return x < lo ? lo : (x > hi ? hi : x);
+		}
+
+		// sqrt of a positive normal x. With math-errno on, GCC guards every
+		// sqrt with a libm call (which blocks vectorization, and GCC 12 ignores
+		// optimize("no-math-errno")), so in that case use Newton on 1/sqrt(x)
+		// from the bit-trick seed, then one Markstein correction (<= 1 ulp).
+		template<VectorFloat T>
+		inline T sqrt(T x) noexcept {
+#if !(defined(__GNUC__) || defined(__clang__))
+			return std::sqrt(x);
+#elif defined(__NO_MATH_ERRNO__)
+			if constexpr (std::is_same_v<T, float>) return __builtin_sqrtf(x);
+			else return __builtin_sqrt(x);
+#else
+			T r;
+			if constexpr (std::is_same_v<T, double>) {
+				r = bits<double>(0x5fe6eb50c7b537a9 - (bits<std::uint64_t>(x) >> 1));
+				for (int i{}; i < 4; ++i) r *= 1.5 - 0.5 * x * r * r;
+			}
+			else {
+				r = bits<float>(0x5f375a86u - (bits<std::uint32_t>(x) >> 1));
+				for (int i{}; i < 3; ++i) r *= 1.5f - 0.5f * x * r * r;
+			}
+			const T s = x * r;
+			return s + static_cast<T>(0.5) * r * (x - s * s);
+#endif
+		}
+	}
+
+	template<Arithmetic T>
+	inline T poly_exp(T x) noexcept {
+		ITO_VMATH_STRICT_FP
+		if constexpr (std::is_same_v<T, double>) {
+			// Cody-Waite split of ln2 (fdlibm): k*ln2_hi is exact for |k| < 2^11
+			constexpr double ln2_hi = 6.93147180369123816490e-01;
+			constexpr double ln2_lo = 1.90821492927058770002e-10;
+			constexpr double log2e = 1.44269504088896338700e+00;
+			constexpr double shifter = 0x1.8p52;  // |k| < 2^51 lands in the low mantissa bits
+
+			constexpr double infinity = std::numeric_limits<double>::infinity();
+			const double xc = detail::clamp(x, -708.0, 709.0);
+
+			// Step 1 - Reduce: x = k*ln2 + r, |r| <= ln2/2
+			const double k = detail::round_nearest(xc * log2e);
+			const double r = (xc - k * ln2_hi) - k * ln2_lo;
+
+			// Step 2 - e^r by Taylor polynomial of degree 13 (truncation < 2^-60)
+			double p = 1.0 / 6227020800.0;
+			p = p * r + 1.0 / 479001600.0;
+			p = p * r + 1.0 / 39916800.0;
+			p = p * r + 1.0 / 3628800.0;
+			p = p * r + 1.0 / 362880.0;
+			p = p * r + 1.0 / 40320.0;
+			p = p * r + 1.0 / 5040.0;
+			p = p * r + 1.0 / 720.0;
+			p = p * r + 1.0 / 120.0;
+			p = p * r + 1.0 / 24.0;
+			p = p * r + 1.0 / 6.0;
+			p = p * r + 0.5;
+			p = p * r + 1.0;
+			p = p * r + 1.0;
+
+			// Step 3 - Scale by 2^k through the exponent field
+			const std::uint64_t ki = detail::bits<std::uint64_t>(k + shifter) - detail::bits<std::uint64_t>(shifter);
+			const double scale = detail::bits<double>((ki + 1023) << 52);
+			const double result = p * scale;
+
+			return x > 709.0 ? infinity : (x < -708.0 ? 0.0 : result);
+		}
+		else if constexpr (std::is_same_v<T, float>) {
+			constexpr float ln2_hi = 6.9314575195e-01f;
+			constexpr float ln2_lo = 1.4286067653e-06f;
+			constexpr float log2e = 1.4426950408889634f;
+			constexpr float shifter = 0x1.8p23f;
+
+			constexpr float infinity = std::numeric_limits<float>::infinity();
+			const float xc = detail::clamp(x, -87.0f, 88.0f);
+
+			const float k = detail::round_nearest(xc * log2e);
+			const float r = (xc - k * ln2_hi) - k * ln2_lo;
+
+			// Degree 7 (truncation < 2^-27)
+			float p = 1.0f / 5040.0f;
+			p = p * r + 1.0f / 720.0f;
+			p = p * r + 1.0f / 120.0f;
+			p = p * r + 1.0f / 24.0f;
+			p = p * r + 1.0f / 6.0f;
+			p = p * r + 0.5f;
+			p = p * r + 1.0f;
+			p = p * r + 1.0f;
+
+			const std::uint32_t ki = detail::bits<std::uint32_t>(k + shifter) - detail::bits<std::uint32_t>(shifter);
+			const float scale = detail::bits<float>((ki + 127) << 23);
+			const float result = p * scale;
+
+			return x > 88.0f ? infinity : (x < -87.0f ? 0.0f : result);
+		}
+		else {
+			using std::exp;
+			return exp(x);
+		}
+	}
+
+	template<Arithmetic T>
+	inline T poly_log(T x) noexcept {
+		ITO_VMATH_STRICT_FP
+		if constexpr (std::is_same_v<T, double>) {
+			constexpr double ln2_hi = 6.93147180369123816490e-01;
+			constexpr double ln2_lo = 1.90821492927058770002e-10;
+			constexpr std::uint64_t sqrt_half = 0x3fe6a09e667f3bcd;  // bits of sqrt(2)/2
+
+			// fdlibm minimax coefficients for (log(1+f) - 2s)/s, s = f/(2+f)
+			constexpr double Lg1 = 6.666666666666735130e-01;
+			constexpr double Lg2 = 3.999999999940941908e-01;
+			constexpr double Lg3 = 2.857142874366239149e-01;
+			constexpr double Lg4 = 2.222219843214978396e-01;
+			constexpr double Lg5 = 1.818357216161805012e-01;
+			constexpr double Lg6 = 1.531383769920937332e-01;
+			constexpr double Lg7 = 1.479819860511658591e-01;
+
+			// Step 1 - x = 2^k * m, m in [sqrt(2)/2, sqrt(2))
+			const std::uint64_t ix = detail::bits<std::uint64_t>(x) - sqrt_half;
+			// (exponent narrowed to 32 bits: int64 -> double needs AVX-512DQ)
+			const double k = static_cast<double>(static_cast<std::int32_t>(static_cast<std::int64_t>(ix) >> 52));
+			const double m = detail::bits<double>((ix & 0x000fffffffffffff) + sqrt_half);
+
+			// Step 2 - log(m) = f - f²/2 + s*(f²/2 + R(s²))
+			const double f = m - 1.0;
+			const double s = f / (2.0 + f);
+			const double z = s * s;
+			const double w = z * z;
+			const double t1 = w * (Lg2 + w * (Lg4 + w * Lg6));
+			const double t2 = z * (Lg1 + w * (Lg3 + w * (Lg5 + w * Lg7)));
+			const double R = t1 + t2;
+			const double hfsq = 0.5 * f * f;
+
+			// Step 3 - log(x) = k*ln2 + log(m), low part of ln2 added first
+			return k * ln2_hi - ((hfsq - (s * (hfsq + R) + k * ln2_lo)) - f);
+		}
+		else if constexpr (std::is_same_v<T, float>) {
+			constexpr float ln2_hi = 6.9313812256e-01f;
+			constexpr float ln2_lo = 9.0580006145e-06f;
+			constexpr std::uint32_t sqrt_half = 0x3f3504f3;
+
+			constexpr float Lg1 = 6.6666668653e-01f;
+			constexpr float Lg2 = 4.0000000596e-01f;
+			constexpr float Lg3 = 2.8571429849e-01f;
+			constexpr float Lg4 = 2.2222198546e-01f;
+
+			const std::uint32_t ix = detail::bits<std::uint32_t>(x) - sqrt_half;
+			const float k = static_cast<float>(static_cast<std::int32_t>(ix) >> 23);
+			const float m = detail::bits<float>((ix & 0x007fffff) + sqrt_half);
+
+			const float f = m - 1.0f;
+			const float s = f / (2.0f + f);
+			const float z = s * s;
+			const float w = z * z;
+			const float t1 = w * (Lg2 + w * Lg4);
+			const float t2 = z * (Lg1 + w * Lg3);
+			const float R = t1 + t2;
+			const float hfsq = 0.5f * f * f;
+
+			return k * ln2_hi - ((hfsq - (s * (hfsq + R) + k * ln2_lo)) - f);
+		}
+		else {
+			using std::log;
+			return log(x);
+		}
+	}
+
+	/**
+	 * sin and cos of 2*pi*turns, for turns in [0, 1] (Box-Muller angles)
+	 * Exact quadrant reduction (4*turns - q needs no rounding), then the
+	 * fdlibm / musl kernels on [-pi/4, pi/4].
+	 */
+	template<Arithmetic T>
+	inline void poly_sincos_turns(T turns, T& sin_out, T& cos_out) noexcept {
+		ITO_VMATH_STRICT_FP
+		if constexpr (detail::VectorFloat<T>) {
+			// Step 1 - turns = (q + f) / 4, |f| <= 1/2, x = f * pi/2
+			const T q = detail::round_nearest(static_cast<T>(4) * turns);
+			constexpr T half_pi = std::numbers::pi_v<T> / static_cast<T>(2);
+			const T x = (static_cast<T>(4) * turns - q) * half_pi;
+			const std::int32_t quadrant = static_cast<std::int32_t>(q) & 3;
+			const T z = x * x;
+
+			// Step 2 - Kernels on [-pi/4, pi/4]
+			T s, c;
+			if constexpr (std::is_same_v<T, double>) {
+				constexpr double S1 = -1.66666666666666324348e-01;
+				constexpr double S2 = 8.33333333332248946124e-03;
+				constexpr double S3 = -1.98412698298579493134e-04;
+				constexpr double S4 = 2.75573137070700676789e-06;
+				constexpr double S5 = -2.50507602534068634195e-08;
+				constexpr double S6 = 1.58969099521155010221e-10;
+				constexpr double C1 = 4.16666666666666019037e-02;
+				constexpr double C2 = -1.38888888888741095749e-03;
+				constexpr double C3 = 2.48015872894767294178e-05;
+				constexpr double C4 = -2.75573143513906633035e-07;
+				constexpr double C5 = 2.08757232129817482790e-09;
+				constexpr double C6 = -1.13596475577881948265e-11;
+
+				const double r = S2 + z * (S3 + z * (S4 + z * (S5 + z * S6)));
+				s = x + z * x * (S1 + z * r);
+
+				// cos = 1 - z/2 + z*R(z), with the rounding error of 1 - z/2 recovered
+				const double w2 = z * z;
+				const double rc = z * (C1 + z * (C2 + z * C3)) + w2 * w2 * (C4 + z * (C5 + z * C6));
+				const double hz = 0.5 * z;
+				const double w = 1.0 - hz;
+				c = w + (((1.0 - w) - hz) + z * rc);
+			}
+			else {
+				constexpr float S1 = -1.66666666416265235595e-01f;
+				constexpr float S2 = 8.33332938588946318e-03f;
+				constexpr float S3 = -1.98393348360966317347e-04f;
+				constexpr float S4 = 2.71831149398982190640e-06f;
+				constexpr float C0 = -4.99999997251031003120e-01f;
+				constexpr float C1 = 4.16666233237390631894e-02f;
+				constexpr float C2 = -1.38867637746099294692e-03f;
+				constexpr float C3 = 2.43904487962774090654e-05f;
+
+				s = x + z * x * (S1 + z * (S2 + z * (S3 + z * S4)));
+				c = 1.0f + z * (C0 + z * (C1 + z * (C2 + z * C3)));
+			}
+
+			// Step 3 - Rotate by the quadrant
+			const bool swap = (quadrant & 1) != 0;
+			const T sin_base = swap ? c : s;
+			const T cos_base = swap ? s : c;
+			sin_out = (quadrant & 2) ? -sin_base : sin_base;
+			cos_out = ((quadrant + 1) & 2) ? -cos_base : cos_base;
+		}
+		else {
+			const T theta = static_cast<T>(2) * std::numbers::pi_v<T> * turns;
+			sin_out = std::sin(theta);
+			cos_out = std::cos(theta);
+		}
+	}
+
+	namespace detail {
+		template<VectorFloat T>
+		inline void vexp_loop(const T* in, T* out, size_t n) noexcept {
+			for (size_t i{}; i < n; ++i) out[i] = poly_exp(in[i]);
+		}
+
+		template<VectorFloat T>
+		inline void vlog_loop(const T* in, T* out, size_t n) noexcept {
+			for (size_t i{}; i < n; ++i) out[i] = poly_log(in[i]);
+		}
+
+		// z0 = sqrt(-2 ln u1) cos(2 pi u2), z1 = sqrt(-2 ln u1) sin(2 pi u2)
+		template<VectorFloat T>
+		inline void box_muller(T u1, T u2, T& z0, T& z1) noexcept {
+			const T radius = detail::sqrt(static_cast<T>(-2) * poly_log(u1));
+			T s, c;
+			poly_sincos_turns(u2, s, c);
+			z0 = radius * c;
+			z1 = radius * s;
+		}
+
+		template<VectorFloat T>
+		inline void box_muller_loop(const T* u1, const T* u2, T* z0, T* z1, size_t n) noexcept {
+			for (size_t i{}; i < n; ++i) box_muller(u1[i], u2[i], z0[i], z1[i]);
+		}
+
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define ITO_HAS_SIMD_DISPATCH 1
+
+		enum class SimdLevel { Baseline, AVX2, AVX512 };
+
+		inline SimdLevel detect_simd_level() noexcept {
+			__builtin_cpu_init();
+			if (__builtin_cpu_supports("avx512f")) return SimdLevel::AVX512;
+			if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")) return SimdLevel::AVX2;
+			return SimdLevel::Baseline;
+		}
+
+		inline SimdLevel simd_level() noexcept {
+			static const SimdLevel level = detect_simd_level();
+			return level;
+		}
+
+		// Same loops, compiled for wider ISAs (the kernels inline into them)
+		template<VectorFloat T>
+		__attribute__((target("avx2,fma"))) void vexp_avx2(const T* in, T* out, size_t n) noexcept {
+			for (size_t i{}; i < n; ++i) out[i] = poly_exp(in[i]);
+		}
+
+		template<VectorFloat T>
+		__attribute__((target("avx512f"))) void vexp_avx512(const T* in, T* out, size_t n) noexcept {
+			for (size_t i{}; i < n; ++i) out[i] = poly_exp(in[i]);
+		}
+
+		template<VectorFloat T>
+		__attribute__((target("avx2,fma"))) void vlog_avx2(const T* in, T* out, size_t n) noexcept {
+			for (size_t i{}; i < n; ++i) out[i] = poly_log(in[i]);
+		}
+
+		template<VectorFloat T>
+		__attribute__((target("avx512f"))) void vlog_avx512(const T* in, T* out, size_t n) noexcept {
+			for (size_t i{}; i < n; ++i) out[i] = poly_log(in[i]);
+		}
+
+		template<VectorFloat T>
+		__attribute__((target("avx2,fma"))) void box_muller_avx2(const T* u1, const T* u2, T* z0, T* z1, size_t n) noexcept {
+			for (size_t i{}; i < n; ++i) box_muller(u1[i], u2[i], z0[i], z1[i]);
+		}
+
+		template<VectorFloat T>
+		__attribute__((target("avx512f"))) void box_muller_avx512(const T* u1, const T* u2, T* z0, T* z1, size_t n) noexcept {
+			for (size_t i{}; i < n; ++i) box_muller(u1[i], u2[i], z0[i], z1[i]);
+		}
+#endif
+	}
+
+	/**
+	 * out[i] = exp(in[i]) for whole buffers; in and out may alias
+	 * float and double use the dispatched SIMD kernels, other types (including
+	 * number types such as Dual) their own exp.
+	 */
+	template<Arithmetic T>
+	inline void vexp(std::span<const T> in, std::span<T> out) noexcept {
+		if constexpr (detail::VectorFloat<T>) {
+#if defined(ITO_HAS_SIMD_DISPATCH)
+			switch (detail::simd_level()) {
+			case detail::SimdLevel::AVX512:
+				return detail::vexp_avx512(in.data(), out.data(), in.size());
+			case detail::SimdLevel::AVX2:
+				return detail::vexp_avx2(in.data(), out.data(), in.size());
+			default:
+				break;
+			}
+#endif
+			detail::vexp_loop(in.data(), out.data(), in.size());
+		}
+		else {
+			using std::exp;
+			for (size_t i{}; i < in.size(); ++i) out[i] = exp(in[i]);
+		}
+	}
+
+	// out[i] = log(in[i]) for whole buffers; in and out may alias
+	template<Arithmetic T>
+	inline void vlog(std::span<const T> in, std::span<T> out) noexcept {
+		if constexpr (detail::VectorFloat<T>) {
+#if defined(ITO_HAS_SIMD_DISPATCH)
+			switch (detail::simd_level()) {
+			case detail::SimdLevel::AVX512:
+				return detail::vlog_avx512(in.data(), out.data(), in.size());
+			case detail::SimdLevel::AVX2:
+				return detail::vlog_avx2(in.data(), out.data(), in.size());
+			default:
+				break;
+			}
+#endif
+			detail::vlog_loop(in.data(), out.data(), in.size());
+		}
+		else {
+			using std::log;
+			for (size_t i{}; i < in.size(); ++i) out[i] = log(in[i]);
+		}
+	}
+
+	/**
+	 * Box-Muller on whole buffers: uniforms u1, u2 in (0, 1) to independent
+	 * normals z0 = sqrt(-2 ln u1) cos(2 pi u2), z1 = sqrt(-2 ln u1) sin(2 pi u2)
+	 * The outputs must not alias the inputs.
+	 */
+	template<Arithmetic T>
+	inline void vbox_muller(std::span<const T> u1, std::span<const T> u2, std::span<T> z0, std::span<T> z1) noexcept {
+		if constexpr (detail::VectorFloat<T>) {
+#if defined(ITO_HAS_SIMD_DISPATCH)
+			switch (detail::simd_level()) {
+			case detail::SimdLevel::AVX512:
+				return detail::box_muller_avx512(u1.data(), u2.data(), z0.data(), z1.data(), u1.size());
+			case detail::SimdLevel::AVX2:
+				return detail::box_muller_avx2(u1.data(), u2.data(), z0.data(), z1.data(), u1.size());
+			default:
+				break;
+			}
+#endif
+			detail::box_muller_loop(u1.data(), u2.data(), z0.data(), z1.data(), u1.size());
+		}
+		else {
+			for (size_t i{}; i < u1.size(); ++i) {
+				const T radius = std::sqrt(static_cast<T>(-2) * std::log(u1[i]));
+				T s, c;
+				poly_sincos_turns(u2[i], s, c);
+				z0[i] = radius * c;
+				z1[i] = radius * s;
+			}
+		}
+	}
+}
+
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC pop_options
+#endif
+#undef ITO_VMATH_STRICT_FP